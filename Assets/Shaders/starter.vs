@@ -1,16 +1,20 @@
 // Author: David Wong
 // Email: david.wongcascante@digipen.edu
 // Created: 27 Apr 2018
-// Last Modified: 14 Feb 2019
+// Last Modified: 17 Oct 2026
 // File name: starterVS.vs
 
 #version 430 core
 layout (location = 0) in vec3 pos;
 layout (location = 1) in vec2 texCoords;
-layout (location = 2) in mat4 modelTransform;
-// Texture coordinate modifications where (x,y) are translations and (z,w) are scale in x and y axes
-layout (location = 6) in vec4 texCoordModif;
-layout (location = 7) in float textureID;
+// The compact model transformation, the rotated and scaled x and y axes in (x,y) and (z,w)
+layout (location = 2) in vec4 modelAxes;
+// The model translation, where z is the depth
+layout (location = 3) in vec3 modelTranslation;
+// Texture coordinate modifications, the translation and the scale in the x and y axes
+layout (location = 4) in vec2 texCoordTranslation;
+layout (location = 5) in vec2 texCoordScale;
+layout (location = 6) in float textureID;
 
 out vec2 TexCoords;
 out float TextureID;
@@ -19,9 +23,14 @@ uniform mat4 camera;
 void main()
 {
 	TexCoords = texCoords;
-	TexCoords.x *= texCoordModif.z;
-	TexCoords.y *= texCoordModif.w;
-	TexCoords += texCoordModif.xy;
+	TexCoords *= texCoordScale;
+	TexCoords += texCoordTranslation;
 	TextureID = textureID;
+	// Rebuild the full model matrix, rotations only happen around the z axis
+	mat4 modelTransform = mat4(
+		vec4(modelAxes.xy, 0.0, 0.0),
+		vec4(modelAxes.zw, 0.0, 0.0),
+		vec4(0.0, 0.0, 1.0, 0.0),
+		vec4(modelTranslation, 1.0));
 	gl_Position = camera * modelTransform * vec4(pos, 1.0);
 }
\ No newline at end of file
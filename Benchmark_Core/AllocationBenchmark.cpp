@@ -0,0 +1,121 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: AllocationBenchmark.cpp
+* Description: Compares the object and component pools against the global allocator, and measures spawning and despawning objects
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Benchmark.h"			// Benchmark
+#include "Drifter.h"			// Drifter
+
+#include <cstdio>				// Sprintf
+#include <vector>				// Vector
+#include <random>				// Random Engine
+#include <algorithm>			// Shuffle
+#include <PoolAllocator.h>		// Pool Allocator
+#include <GameObjectManager.h>	// Game Object Manager
+#include <GameObject.h>			// Game Object
+#include <Transform.h>			// Transform
+
+namespace
+{
+	// The sizes of the blocks taken for every spawned object, matching what a Drifter archetype allocates
+	const size_t blockSizes[] = { sizeof(Junior::GameObject), sizeof(Junior::Transform), sizeof(JuniorBenchmark::Drifter) };
+	// The number of block sizes
+	const size_t blockSizeCount = sizeof(blockSizes) / sizeof(blockSizes[0]);
+
+	// Takes the blocks of many objects and gives them back in a shuffled order, the way objects die during a game
+	// Params:
+	//	allocate: Takes a block of one of the sizes, called as allocate(sizeIndex)
+	//	free: Gives a block back, called as free(sizeIndex, block)
+	//	objects: The number of objects spawned every cycle
+	//	cycles: The number of spawn and despawn cycles
+	template <typename Allocate, typename Free>
+	void Churn(const Allocate& allocate, const Free& free, size_t objects, unsigned cycles)
+	{
+		std::vector<std::pair<size_t, void*>> blocks;
+		blocks.reserve(objects * blockSizeCount);
+		std::mt19937 random(1234);
+		for (unsigned cycle = 0; cycle < cycles; ++cycle)
+		{
+			for (size_t i = 0; i < objects; ++i)
+			{
+				for (size_t size = 0; size < blockSizeCount; ++size)
+				{
+					blocks.push_back(std::make_pair(size, allocate(size)));
+				}
+			}
+			std::shuffle(blocks.begin(), blocks.end(), random);
+			for (const std::pair<size_t, void*>& block : blocks)
+			{
+				free(block.first, block.second);
+			}
+			blocks.clear();
+		}
+	}
+}
+
+void JuniorBenchmark::RunAllocationBenchmark()
+{
+	const size_t objects = 10000;
+	const unsigned cycles = 50;
+	const double allocations = static_cast<double>(objects) * blockSizeCount * cycles;
+	char measurement[64];
+
+	// The same spawn and despawn pattern through the global allocator and through pools of the same block sizes
+	Stopwatch stopwatch;
+	Churn([](size_t size) { return ::operator new(blockSizes[size]); }, [](size_t, void* block) { ::operator delete(block); }, objects, cycles);
+	Report("Allocation", "global allocator, allocate and free", stopwatch.GetMilliseconds() * 1000000.0 / allocations, "ns/block");
+
+	std::vector<Junior::PoolAllocator*> pools;
+	for (size_t size = 0; size < blockSizeCount; ++size)
+	{
+		pools.push_back(new Junior::PoolAllocator(blockSizes[size], alignof(std::max_align_t), 256));
+	}
+	stopwatch.Restart();
+	Churn([&pools](size_t size) { return pools[size]->Allocate(); }, [&pools](size_t size, void* block) { pools[size]->Free(block); }, objects, cycles);
+	Report("Allocation", "pools, allocate and free", stopwatch.GetMilliseconds() * 1000000.0 / allocations, "ns/block");
+	for (Junior::PoolAllocator* pool : pools)
+	{
+		delete pool;
+	}
+
+	// Then whole objects, spawned from an archetype and destroyed at the end of the frame
+	Junior::GameObjectManager& manager = Junior::GameObjectManager::GetInstance();
+	Junior::GameObject* archetype = new Junior::GameObject("Drifter", true);
+	archetype->AddComponent(new Junior::Transform());
+	archetype->AddComponent(new Drifter());
+	manager.AddArchetype(archetype);
+	std::vector<Junior::GameObject*> spawned;
+	double spawnTime = 0.0;
+	double despawnTime = 0.0;
+	for (unsigned cycle = 0; cycle < cycles; ++cycle)
+	{
+		spawned.clear();
+		stopwatch.Restart();
+		manager.SpawnBatch("Drifter", objects, Junior::SpawnFunction(), &spawned);
+		spawnTime += stopwatch.GetMilliseconds();
+
+		stopwatch.Restart();
+		for (Junior::GameObject* object : spawned)
+		{
+			object->Destroy();
+		}
+		manager.CollectDestroyed();
+		despawnTime += stopwatch.GetMilliseconds();
+	}
+	sprintf(measurement, "spawn %zu objects from an archetype", objects);
+	Report("Allocation", measurement, spawnTime / cycles, "ms");
+	sprintf(measurement, "despawn %zu objects", objects);
+	Report("Allocation", measurement, despawnTime / cycles, "ms");
+
+	// Every object went back to the pool, which keeps its slabs for the next spawn
+	Junior::PoolAllocator& objectPool = Junior::GameObject::GetPool();
+	Report("Allocation", "object pool, live blocks", static_cast<double>(objectPool.GetLiveCount()), "blocks");
+	Report("Allocation", "object pool, free blocks", static_cast<double>(objectPool.GetFreeCount()), "blocks");
+	Report("Allocation", "object pool, slabs", static_cast<double>(objectPool.GetSlabCount()), "slabs");
+	manager.Unload();
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: Benchmark.cpp
+* Description: Defines the stopwatch and report shared by the benchmarks
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Benchmark.h"			// Benchmark
+
+#include <cstdio>				// Printf
+
+// Public Member Functions
+
+JuniorBenchmark::Stopwatch::Stopwatch()
+	: start_(std::chrono::steady_clock::now())
+{
+}
+
+void JuniorBenchmark::Stopwatch::Restart()
+{
+	start_ = std::chrono::steady_clock::now();
+}
+
+double JuniorBenchmark::Stopwatch::GetMilliseconds() const
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_).count();
+}
+
+// Functions
+
+void JuniorBenchmark::Report(const char* benchmark, const char* measurement, double value, const char* unit)
+{
+	printf("%-12s %-48s %12.3f %s\n", benchmark, measurement, value, unit);
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: Benchmark.h
+* Description: Declares the engine's benchmarks, and the stopwatch and report they share
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <chrono>				// Steady Clock
+
+namespace JuniorBenchmark
+{
+	// Measures the time passed since it was started
+	class Stopwatch
+	{
+	private:
+		// Private Member Variables
+
+		// When the stopwatch was started
+		std::chrono::steady_clock::time_point start_;
+	public:
+		// Public Member Functions
+
+		// Constructor, starts the stopwatch
+		Stopwatch();
+		// Starts the stopwatch again
+		void Restart();
+		// Returns: The milliseconds passed since the stopwatch was started
+		double GetMilliseconds() const;
+	};
+
+	// Prints one result of a benchmark
+	// Params:
+	//	benchmark: The name of the benchmark
+	//	measurement: What was measured
+	//	value: The measured value
+	//	unit: The unit of the value
+	void Report(const char* benchmark, const char* measurement, double value, const char* unit);
+
+	// Benchmarks
+
+	// Measures a frame of object updates at 10k and 100k objects, with the components allocated on their own and stored in archetype columns
+	void RunStorageBenchmark();
+	// Compares the inline Mat3 and Vec3 math against plain C++ loops doing the same work
+	void RunMathBenchmark();
+	// Measures how the job system scales with the number of threads
+	void RunJobBenchmark();
+	// Compares the object and component pools against the global allocator, and measures spawning and despawning objects
+	void RunAllocationBenchmark();
+	// Measures destroying a tenth of 100k objects in a single frame
+	void RunDestroyBenchmark();
+	// Measures the memory every archetype instance takes and how long spawning them takes, with their settings shared and unshared
+	void RunInstanceBenchmark();
+}
\ No newline at end of file
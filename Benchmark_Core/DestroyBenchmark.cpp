@@ -0,0 +1,59 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: DestroyBenchmark.cpp
+* Description: Measures destroying a tenth of 100k objects in a single frame
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Benchmark.h"			// Benchmark
+#include "Drifter.h"			// Drifter
+
+#include <vector>				// Vector
+#include <GameObjectManager.h>	// Game Object Manager
+#include <GameObject.h>			// Game Object
+#include <Transform.h>			// Transform
+
+void JuniorBenchmark::RunDestroyBenchmark()
+{
+	const size_t objects = 100000;
+	const size_t stride = 10;
+	const unsigned runs = 5;
+
+	Junior::GameObjectManager& manager = Junior::GameObjectManager::GetInstance();
+	double collectTime = 0.0;
+	double frameTime = 0.0;
+	for (unsigned run = 0; run < runs; ++run)
+	{
+		Junior::GameObject* archetype = new Junior::GameObject("Drifter", true);
+		archetype->AddComponent(new Junior::Transform());
+		archetype->AddComponent(new Drifter());
+		manager.AddArchetype(archetype);
+		std::vector<Junior::GameObject*> spawned;
+		manager.SpawnBatch("Drifter", objects, Junior::SpawnFunction(), &spawned);
+		manager.Update(0.0);
+
+		// Every tenth object, spread over the whole list so the swaps reach from the back to the front
+		for (size_t i = 0; i < objects; i += stride)
+		{
+			spawned[i]->Destroy();
+		}
+		Stopwatch stopwatch;
+		manager.CollectDestroyed();
+		collectTime += stopwatch.GetMilliseconds();
+
+		// Then a whole frame destroying as many, with the updates around the collection
+		for (size_t i = 1; i < objects; i += stride)
+		{
+			spawned[i]->Destroy();
+		}
+		stopwatch.Restart();
+		manager.Update(0.0);
+		frameTime += stopwatch.GetMilliseconds();
+		manager.Unload();
+	}
+	Report("Destroy", "10000 of 100000 objects, collection only", collectTime / runs, "ms");
+	Report("Destroy", "10000 of 90000 objects, whole frame", frameTime / runs, "ms");
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: Drifter.cpp
+* Description: Moves its object a little every frame, standing in for the game's components in the benchmarks
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Drifter.h"			// Drifter
+
+#include <GameObject.h>			// Game Object
+#include <Transform.h>			// Transform
+
+// Public Member Functions
+
+JuniorBenchmark::Drifter::Drifter(const Junior::Vec3& step)
+	: step_(step)
+{
+}
+
+JuniorBenchmark::Drifter::Drifter(const Drifter& other)
+	: Component(), step_(other.step_)
+{
+}
+
+void JuniorBenchmark::Drifter::Initialize()
+{
+	updateable_ = true;
+}
+
+void JuniorBenchmark::Drifter::Update(double)
+{
+	Junior::Transform* transform = owner_->GetComponent<Junior::Transform>();
+	transform->SetLocalTranslation(transform->GetLocalTranslation() + step_);
+}
+
+void JuniorBenchmark::Drifter::DeclareAccess(Junior::ComponentAccess& access)
+{
+	access.Writes<Junior::Transform>();
+}
\ No newline at end of file
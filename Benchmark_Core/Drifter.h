@@ -0,0 +1,46 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: Drifter.h
+* Description: Moves its object a little every frame, standing in for the game's components in the benchmarks
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <Component.h>			// Component
+#include <Vec3.h>				// Vec3
+
+namespace JuniorBenchmark
+{
+	class Drifter : public Junior::Component<Drifter>
+	{
+	private:
+		// Private Member Variables
+
+		// How far the object moves every frame
+		Junior::Vec3 step_;
+	public:
+		// Public Member Functions
+
+		// Constructor
+		// Params:
+		//	step: How far the object moves every frame
+		Drifter(const Junior::Vec3& step = Junior::Vec3(1, 0, 0, 0));
+		// Copy Constructor
+		// Params:
+		//	other: The other drifter we are copying from
+		Drifter(const Drifter& other);
+		// Initializes the component
+		void Initialize() override;
+		// Moves the object's transform by the step
+		// Params:
+		//	dt: The delta time between frames, unused so every frame does the same work
+		void Update(double dt) override;
+		// Declares the component types read and written while updating
+		// Params:
+		//	access: The access being declared
+		static void DeclareAccess(Junior::ComponentAccess& access);
+	};
+}
\ No newline at end of file
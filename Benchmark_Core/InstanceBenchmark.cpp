@@ -0,0 +1,94 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: InstanceBenchmark.cpp
+* Description: Measures the memory every archetype instance takes and how long spawning them takes, with their settings shared and unshared
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Benchmark.h"			// Benchmark
+
+#include <vector>				// Vector
+#include <GameObjectManager.h>	// Game Object Manager
+#include <GameObject.h>			// Game Object
+#include <Transform.h>			// Transform
+#include <ParticleEmitter.h>	// Particle Emitter
+#include <Animator.h>			// Animator
+#include <Sprite.h>				// Sprite
+
+void JuniorBenchmark::RunInstanceBenchmark()
+{
+	const size_t objects = 10000;
+	const unsigned maxParticles = 64;
+	const unsigned runs = 5;
+
+	// Emitters are the only one of these components that can be initialized without a window, so they go through the manager
+	Junior::GameObjectManager& manager = Junior::GameObjectManager::GetInstance();
+	Junior::ParticleEmitter::Settings settings;
+	settings.maxParticles_ = maxParticles;
+	settings.particleSpawnCount_ = maxParticles / 4;
+	settings.minLifeTime_ = 1.0f;
+	settings.maxLifeTime_ = 2.0f;
+	double sharedTime = 0.0;
+	double unsharedTime = 0.0;
+	for (unsigned run = 0; run < runs; ++run)
+	{
+		Junior::GameObject* archetype = new Junior::GameObject("Emitter", true);
+		archetype->AddComponent(new Junior::Transform());
+		Junior::ParticleEmitter* prototype = new Junior::ParticleEmitter();
+		prototype->EditSettings() = settings;
+		archetype->AddComponent(prototype);
+		manager.AddArchetype(archetype);
+
+		Stopwatch stopwatch;
+		manager.SpawnBatch("Emitter", objects);
+		sharedTime += stopwatch.GetMilliseconds();
+		manager.Unload();
+
+		// The same spawn with every emitter taking its own copy of the settings, the way every copy used to carry them
+		archetype = new Junior::GameObject("Emitter", true);
+		archetype->AddComponent(new Junior::Transform());
+		prototype = new Junior::ParticleEmitter();
+		prototype->EditSettings() = settings;
+		archetype->AddComponent(prototype);
+		manager.AddArchetype(archetype);
+		stopwatch.Restart();
+		manager.SpawnBatch("Emitter", objects, [](Junior::GameObject* object, size_t) { object->GetComponent<Junior::ParticleEmitter>()->EditSettings(); });
+		unsharedTime += stopwatch.GetMilliseconds();
+		manager.Unload();
+	}
+	Report("Instance", "emitter spawn, settings shared", sharedTime * 1000000.0 / (runs * objects), "ns/object");
+	Report("Instance", "emitter spawn, settings copied", unsharedTime * 1000000.0 / (runs * objects), "ns/object");
+	Report("Instance", "emitter component", static_cast<double>(sizeof(Junior::ParticleEmitter)), "bytes/instance");
+	Report("Instance", "emitter particles", static_cast<double>(maxParticles * sizeof(Junior::Particle)), "bytes/instance");
+	Report("Instance", "emitter settings, once per archetype", static_cast<double>(sizeof(Junior::ParticleEmitter::Settings)), "bytes");
+
+	// Animators and sprites read the texture atlas when initialized, so only copying them is measured
+	Junior::Animator animator(4, 4);
+	Junior::Sprite sprite;
+	std::vector<Junior::Animator*> animators;
+	std::vector<Junior::Sprite*> sprites;
+	animators.reserve(objects);
+	sprites.reserve(objects);
+	Stopwatch stopwatch;
+	for (size_t i = 0; i < objects; ++i)
+	{
+		animators.push_back(new Junior::Animator(animator));
+	}
+	Report("Instance", "animator copy", stopwatch.GetMilliseconds() * 1000000.0 / objects, "ns/object");
+	stopwatch.Restart();
+	for (size_t i = 0; i < objects; ++i)
+	{
+		sprites.push_back(new Junior::Sprite(sprite));
+	}
+	Report("Instance", "sprite copy", stopwatch.GetMilliseconds() * 1000000.0 / objects, "ns/object");
+	for (size_t i = 0; i < objects; ++i)
+	{
+		delete animators[i];
+		delete sprites[i];
+	}
+	Report("Instance", "animator component", static_cast<double>(sizeof(Junior::Animator)), "bytes/instance");
+	Report("Instance", "sprite component", static_cast<double>(sizeof(Junior::Sprite)), "bytes/instance");
+}
\ No newline at end of file
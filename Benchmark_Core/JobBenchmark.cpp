@@ -0,0 +1,96 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: JobBenchmark.cpp
+* Description: Measures how the job system scales with the number of threads, from tiny jobs to a full parallel object update
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Benchmark.h"			// Benchmark
+#include "Drifter.h"			// Drifter
+
+#include <cstdio>				// Sprintf
+#include <cmath>				// Square Root
+#include <vector>				// Vector
+#include <thread>				// Hardware Concurrency
+#include <algorithm>				// Max
+#include <JobSystem.h>			// Job System
+#include <GameObjectManager.h>	// Game Object Manager
+#include <GameObject.h>			// Game Object
+#include <Transform.h>			// Transform
+
+namespace
+{
+	// Keeps the results alive so the compiler cannot drop the loops
+	volatile float sink;
+}
+
+void JuniorBenchmark::RunJobBenchmark()
+{
+	const size_t tinyJobs = 100000;
+	const size_t elements = 1 << 22;
+	const size_t objects = 100000;
+	const unsigned frames = 20;
+
+	Junior::JobSystem& jobSystem = Junior::JobSystem::GetInstance();
+	Junior::GameObjectManager& manager = Junior::GameObjectManager::GetInstance();
+	std::vector<float> values(elements);
+
+	unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+	for (unsigned threads = 1; threads <= std::max(4u, cores); threads *= 2)
+	{
+		// One thread runs without workers, every job then runs right where it is queued
+		if (threads > 1)
+		{
+			jobSystem.SetWorkerCount(threads - 1);
+			jobSystem.Load();
+		}
+		char measurement[64];
+
+		// The cost of queueing and stealing, the jobs themselves do nothing
+		Stopwatch stopwatch;
+		Junior::JobCounter counter;
+		for (size_t i = 0; i < tinyJobs; ++i)
+		{
+			jobSystem.Run([]() {}, &counter);
+		}
+		jobSystem.Wait(counter);
+		sprintf(measurement, "%u threads, empty jobs", jobSystem.GetThreadCount());
+		Report("Jobs", measurement, stopwatch.GetMilliseconds() * 1000000.0 / tinyJobs, "ns/job");
+
+		// Work that only depends on the index, split evenly between the threads
+		stopwatch.Restart();
+		jobSystem.ParallelFor(0, elements, 0, [&values](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				values[i] = sqrtf(static_cast<float>(i)) * 0.5f + sinf(static_cast<float>(i));
+			}
+		});
+		sprintf(measurement, "%u threads, parallel for over 4M floats", jobSystem.GetThreadCount());
+		Report("Jobs", measurement, stopwatch.GetMilliseconds(), "ms");
+		sink = values[elements / 3];
+
+		// The objects split between the workers, with the world transformations rebuilt level by level
+		manager.SetUpdateMode(Junior::OBJECT_PARALLEL_UPDATE);
+		Junior::GameObject* archetype = new Junior::GameObject("Drifter", true);
+		archetype->AddComponent(new Junior::Transform());
+		archetype->AddComponent(new Drifter());
+		manager.AddArchetype(archetype);
+		manager.SpawnBatch("Drifter", objects);
+		manager.Update(0.0);
+		stopwatch.Restart();
+		for (unsigned i = 0; i < frames; ++i)
+		{
+			manager.Update(0.0);
+		}
+		sprintf(measurement, "%u threads, 100000 objects, parallel update", jobSystem.GetThreadCount());
+		Report("Jobs", measurement, stopwatch.GetMilliseconds() / frames, "ms/frame");
+		manager.Unload();
+		manager.SetUpdateMode(Junior::SERIAL_UPDATE);
+
+		jobSystem.Unload();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: MathBenchmark.cpp
+* Description: Compares the engine's inline Mat3 and Vec3 math against plain C++ loops doing the same work
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Benchmark.h"			// Benchmark
+
+#include <vector>				// Vector
+#include <string>				// String
+#include <Mat3.h>				// Matrix3
+#include <Vec3.h>				// Vector3
+#include <LinearMath.h>			// Transpose
+
+namespace
+{
+	// Multiplies two matrices the way the scalar path of the engine does
+	// Params:
+	//	lhs: The left matrix
+	//	rhs: The right matrix
+	// Returns: The multiplied matrices
+	Junior::Mat3 MultiplyScalar(const Junior::Mat3& lhs, const Junior::Mat3& rhs)
+	{
+		Junior::Mat3 out;
+		for (unsigned i = 0; i < 4; ++i)
+		{
+			for (unsigned j = 0; j < 4; ++j)
+			{
+				out.m_[i * 4 + j] = rhs.m_[4 * i + 0] * lhs.m_[4 * 0 + j] + rhs.m_[4 * i + 1] * lhs.m_[4 * 1 + j]
+					+ rhs.m_[4 * i + 2] * lhs.m_[4 * 2 + j] + rhs.m_[4 * i + 3] * lhs.m_[4 * 3 + j];
+			}
+		}
+		return out;
+	}
+
+	// Transforms a vector the way the scalar path of the engine does
+	// Params:
+	//	lhs: The matrix
+	//	rhs: The vector
+	// Returns: The transformed vector
+	Junior::Vec3 TransformScalar(const Junior::Mat3& lhs, const Junior::Vec3& rhs)
+	{
+		Junior::Vec3 out;
+		out.x_ = (lhs.m00_ * rhs.x_) + (lhs.m01_ * rhs.y_) + (lhs.m02_ * rhs.z_) + (lhs.m03_ * rhs.w_);
+		out.y_ = (lhs.m10_ * rhs.x_) + (lhs.m11_ * rhs.y_) + (lhs.m12_ * rhs.z_) + (lhs.m13_ * rhs.w_);
+		out.z_ = (lhs.m20_ * rhs.x_) + (lhs.m21_ * rhs.y_) + (lhs.m22_ * rhs.z_) + (lhs.m23_ * rhs.w_);
+		out.w_ = (lhs.m30_ * rhs.x_) + (lhs.m31_ * rhs.y_) + (lhs.m32_ * rhs.z_) + (lhs.m33_ * rhs.w_);
+		return out;
+	}
+
+	// Adds two vectors the way the scalar path of the engine does
+	// Params:
+	//	lhs: The left vector
+	//	rhs: The right vector
+	// Returns: The added vectors
+	Junior::Vec3 AddScalar(const Junior::Vec3& lhs, const Junior::Vec3& rhs)
+	{
+		Junior::Vec3 out;
+		out.x_ = lhs.x_ + rhs.x_;
+		out.y_ = lhs.y_ + rhs.y_;
+		out.z_ = lhs.z_ + rhs.z_;
+		out.w_ = lhs.w_ + rhs.w_;
+		return out;
+	}
+
+	// Keeps the results alive so the compiler cannot drop the loops
+	volatile float sink;
+}
+
+void JuniorBenchmark::RunMathBenchmark()
+{
+	const size_t count = 4096;
+	const unsigned runs = 200;
+	const double operations = static_cast<double>(count) * runs;
+
+	std::vector<Junior::Mat3> matrices(count);
+	std::vector<Junior::Mat3> products(count);
+	std::vector<Junior::Vec3> vectors(count);
+	std::vector<Junior::Vec3> results(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		for (unsigned j = 0; j < 16; ++j)
+		{
+			matrices[i].m_[j] = static_cast<float>((i * 16 + j) % 7) * 0.25f - 0.5f;
+		}
+		vectors[i] = Junior::Vec3(static_cast<float>(i % 5), static_cast<float>(i % 3), 1.0f, 1.0f);
+	}
+
+	// The engine's math is inline, so it runs the path this file was compiled with
+#if defined(JUNIOR_MATH_AVX)
+	const std::string engine = ", engine avx";
+#elif defined(JUNIOR_MATH_SSE)
+	const std::string engine = ", engine sse2";
+#else
+	const std::string engine = ", engine scalar";
+#endif
+
+	// Every product uses its neighbour, so the loads cannot be hoisted out of the loop
+	Stopwatch stopwatch;
+	for (unsigned run = 0; run < runs; ++run)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			products[i] = MultiplyScalar(matrices[i], matrices[(i + run) % count]);
+		}
+	}
+	Report("Math", "mat3 * mat3, plain loops", stopwatch.GetMilliseconds() * 1000000.0 / operations, "ns/op");
+	sink = products[count / 2].m_[5];
+
+	stopwatch.Restart();
+	for (unsigned run = 0; run < runs; ++run)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			products[i] = matrices[i] * matrices[(i + run) % count];
+		}
+	}
+	Report("Math", ("mat3 * mat3" + engine).c_str(), stopwatch.GetMilliseconds() * 1000000.0 / operations, "ns/op");
+	sink = products[count / 2].m_[5];
+
+	stopwatch.Restart();
+	for (unsigned run = 0; run < runs; ++run)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			results[i] = TransformScalar(matrices[i], vectors[(i + run) % count]);
+		}
+	}
+	Report("Math", "mat3 * vec3, plain loops", stopwatch.GetMilliseconds() * 1000000.0 / operations, "ns/op");
+	sink = results[count / 2].y_;
+
+	stopwatch.Restart();
+	for (unsigned run = 0; run < runs; ++run)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			results[i] = matrices[i] * vectors[(i + run) % count];
+		}
+	}
+	Report("Math", ("mat3 * vec3" + engine).c_str(), stopwatch.GetMilliseconds() * 1000000.0 / operations, "ns/op");
+	sink = results[count / 2].y_;
+
+	stopwatch.Restart();
+	for (unsigned run = 0; run < runs; ++run)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			results[i] = AddScalar(vectors[i], vectors[(i + run) % count]);
+		}
+	}
+	Report("Math", "vec3 + vec3, plain loops", stopwatch.GetMilliseconds() * 1000000.0 / operations, "ns/op");
+	sink = results[count / 2].x_;
+
+	stopwatch.Restart();
+	for (unsigned run = 0; run < runs; ++run)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			results[i] = vectors[i] + vectors[(i + run) % count];
+		}
+	}
+	Report("Math", ("vec3 + vec3" + engine).c_str(), stopwatch.GetMilliseconds() * 1000000.0 / operations, "ns/op");
+	sink = results[count / 2].x_;
+
+	stopwatch.Restart();
+	for (unsigned run = 0; run < runs; ++run)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			products[i] = Junior::Transpose(matrices[(i + run) % count]);
+		}
+	}
+	Report("Math", ("transpose" + engine).c_str(), stopwatch.GetMilliseconds() * 1000000.0 / operations, "ns/op");
+	sink = products[count / 2].m_[5];
+}
\ No newline at end of file
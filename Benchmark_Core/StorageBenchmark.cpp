@@ -0,0 +1,52 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: StorageBenchmark.cpp
+* Description: Measures a frame of object updates with the components allocated on their own and stored in archetype columns
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Benchmark.h"			// Benchmark
+#include "Drifter.h"			// Drifter
+
+#include <cstdio>				// Sprintf
+#include <GameObjectManager.h>	// Game Object Manager
+#include <GameObject.h>			// Game Object
+#include <Transform.h>			// Transform
+
+void JuniorBenchmark::RunStorageBenchmark()
+{
+	const size_t counts[] = { 10000, 100000 };
+	const unsigned frames = 30;
+	Junior::GameObjectManager& manager = Junior::GameObjectManager::GetInstance();
+
+	for (size_t count : counts)
+	{
+		for (int mode = Junior::OBJECT_STORAGE; mode <= Junior::ARCHETYPE_STORAGE; ++mode)
+		{
+			// The storage mode is picked up by the archetype's instances when they are created
+			manager.SetStorageMode(static_cast<Junior::StorageMode>(mode));
+			Junior::GameObject* archetype = new Junior::GameObject("Drifter", true);
+			archetype->AddComponent(new Junior::Transform());
+			archetype->AddComponent(new Drifter());
+			manager.AddArchetype(archetype);
+			manager.SpawnBatch("Drifter", count);
+
+			// Warm up the caches and the updating lists before measuring
+			manager.Update(0.0);
+			Stopwatch stopwatch;
+			for (unsigned i = 0; i < frames; ++i)
+			{
+				manager.Update(0.0);
+			}
+			double frameTime = stopwatch.GetMilliseconds() / frames;
+
+			char measurement[64];
+			sprintf(measurement, "%zu objects, %s", count, mode == Junior::OBJECT_STORAGE ? "object storage" : "archetype storage");
+			Report("Storage", measurement, frameTime, "ms/frame");
+			manager.Unload();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: main.cpp
+* Description: Runs the engine's benchmarks, none of them open a window
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Benchmark.h"			// Benchmark
+
+int main(void)
+{
+	JuniorBenchmark::RunStorageBenchmark();
+	JuniorBenchmark::RunMathBenchmark();
+	JuniorBenchmark::RunJobBenchmark();
+	JuniorBenchmark::RunAllocationBenchmark();
+	JuniorBenchmark::RunDestroyBenchmark();
+	JuniorBenchmark::RunInstanceBenchmark();
+
+	return 0;
+}
\ No newline at end of file
@@ -4,7 +4,7 @@
 * File name: TestLevel.cpp
 * Description: Test level for object management
 * Created: 20 Dec 2018
-* Last Modified: 10 Sep 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -38,8 +38,8 @@
 void WindowResizeCallback(void* object, const Junior::Event* event);
 
 JuniorGame::TestLevel::TestLevel()
-	: Level("TestLevel"), cog_(nullptr), cog2_(nullptr), transform_(nullptr), transform2_(nullptr), timer_(0.0), deletedObject2_(false),
-	  cameraTransform_(nullptr), camera_(nullptr), playerPhysics_(nullptr)
+	: Level("TestLevel"), timer_(0.0), deletedObject2_(false), transform_(nullptr), transform2_(nullptr), cameraTransform_(nullptr),
+	  playerPhysics_(nullptr), cog_(nullptr), cog2_(nullptr), camera_(nullptr)
 {
 }
 
@@ -80,14 +80,23 @@ bool JuniorGame::TestLevel::Initialize()
 void JuniorGame::TestLevel::Update(double dt)
 {
 	//transform_->SetLocalRotation(transform_->GetLocalRotation() + static_cast<float>(dt));
-	transform2_->SetLocalTranslation(
-		Junior::Vec3(300.0f * cosf(static_cast<float>(Junior::Time::GetInstance().GetTimeRan())), -300.0f ,
-					sinf(static_cast<float>(Junior::Time::GetInstance().GetTimeRan())))
-	);
-
-	// Slowly move the camera toward the player
-	Junior::Vec3 toPlayer = transform_->GetLocalTranslation() - cameraTransform_->GetLocalTranslation();
-	cameraTransform_->SetLocalTranslation(cameraTransform_->GetLocalTranslation() + toPlayer * 0.01f);
+	Junior::Transform* transform2 = transform2_.Get();
+	if (transform2)
+	{
+		transform2->SetLocalTranslation(
+			Junior::Vec3(300.0f * cosf(static_cast<float>(Junior::Time::GetInstance().GetTimeRan())), -300.0f ,
+						sinf(static_cast<float>(Junior::Time::GetInstance().GetTimeRan())))
+		);
+	}
+
+	// Slowly move the camera toward the player, as long as both are still alive
+	Junior::Transform* transform = transform_.Get();
+	Junior::Transform* cameraTransform = cameraTransform_.Get();
+	if (transform && cameraTransform)
+	{
+		Junior::Vec3 toPlayer = transform->GetLocalTranslation() - cameraTransform->GetLocalTranslation();
+		cameraTransform->SetLocalTranslation(cameraTransform->GetLocalTranslation() + toPlayer * 0.01f);
+	}
 }
 
 void JuniorGame::TestLevel::Shutdown()
@@ -4,12 +4,13 @@
 * File name: TestLevel.h
 * Description: Test level for object management
 * Created: 20 Dec 2018
-* Last Modified: 28 Jul 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include "Level.h"
 #include "Vec3.h"
+#include "Handle.h"
 
 namespace Junior
 {
@@ -31,12 +32,12 @@ namespace JuniorGame
 		bool deletedObject2_;
 		// Lerping the joystick position
 		Junior::Vec3 lerpJoystickPosition;
-		// The transforms of the game objects
-		Junior::Transform *transform_, *transform2_, *cameraTransform_;
+		// The transforms of the game objects, held through handles so they turn null once the objects are destroyed
+		Junior::Handle<Junior::Transform> transform_, transform2_, cameraTransform_;
 		// The player's physics
-		Junior::Physics* playerPhysics_;
+		Junior::Handle<Junior::Physics> playerPhysics_;
 		// The spawned game objects
-		Junior::GameObject *cog_, *cog2_, *camera_;
+		Junior::Handle<Junior::GameObject> cog_, cog2_, camera_;
 	public:
 		// Constructor
 		TestLevel();
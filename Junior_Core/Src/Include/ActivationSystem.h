@@ -0,0 +1,178 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: ActivationSystem.h
+* Description: Puts tracked objects to sleep outside of a region around the main camera, and wakes them up when they come back in
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <vector>				// Vector
+#include <unordered_map>		// Unordered Map
+#include <cstddef>				// Size T
+#include "Vec3.h"				// Vec3
+
+namespace Junior
+{
+	// Forward Declarations
+	class GameObject;
+	class Transform;
+	class Camera;
+
+	class ActivationSystem
+	{
+	private:
+		// Private Structures
+
+		// How the system tracks an object
+		struct Entry
+		{
+			// Whether the object is dormant
+			bool dormant_;
+			// The cell of the spatial hash the dormant object sits in
+			long long cell_;
+			// The index of the object inside of its cell, or inside of the awake list
+			size_t slot_;
+			// How long the awake object has been outside of the region
+			double outsideTime_;
+		};
+
+		// Private Member Variables
+
+		// Every tracked object
+		std::unordered_map<GameObject*, Entry> entries_;
+		// The dormant objects in every cell of the spatial hash, only the cells around the region are visited
+		std::unordered_map<long long, std::vector<GameObject*>> cells_;
+		// The tracked objects that are awake, in no particular order
+		std::vector<GameObject*> awake_;
+		// The size of a cell of the spatial hash
+		float cellSize_;
+		// Half of the width and height of the region kept awake
+		Vec3 regionExtents_;
+		// The margin kept awake around the main camera's view on every side, as a fraction of the view's size
+		float regionMargin_;
+		// Whether the region was given a size instead of following the main camera's view
+		bool fixedRegion_;
+		// Whether the cell size was given instead of following the size of the region
+		bool fixedCellSize_;
+		// How long an awake object has to stay outside of the region before it goes dormant
+		double sleepDelay_;
+		// Whether the objects added to the manager are tracked
+		bool trackAdded_;
+
+		// Private Member Functions
+
+		// Default Constructor
+		ActivationSystem();
+		// Finds the cell of the spatial hash a position falls in
+		// Params:
+		//	x: The cell's column
+		//	y: The cell's row
+		// Returns: The key of the cell
+		static long long MakeCell(long long x, long long y);
+		// Finds the position of an object
+		// Params:
+		//	object: The object
+		//	position: The position of the object
+		// Returns: Whether the object has a transform to take the position from
+		static bool FindPosition(const GameObject* object, Vec3& position);
+		// Places an object into its cell, or into the awake list
+		// Params:
+		//	object: The object
+		//	entry: The object's entry
+		void Insert(GameObject* object, Entry& entry);
+		// Takes an object out of its cell, or out of the awake list, moving the last object into its place
+		// Params:
+		//	entry: The object's entry
+		void Erase(Entry& entry);
+		// Puts an awake object to sleep
+		// Params:
+		//	object: The object
+		//	entry: The object's entry
+		void PutToSleep(GameObject* object, Entry& entry);
+		// Wakes up a dormant object
+		// Params:
+		//	object: The object
+		//	entry: The object's entry
+		void WakeUp(GameObject* object, Entry& entry);
+		// Moves the dormant objects into the cells of a new size
+		// Params:
+		//	size: The size of a cell
+		void Rehash(float size);
+		// Sizes the region after the main camera's view, and the cells after the region, unless they were given sizes
+		// Params:
+		//	camera: The main camera
+		void FitRegion(const Camera& camera);
+		// Wakes up every dormant object inside of an area
+		// Params:
+		//	center: The center of the area
+		//	extents: Half of the width and height of the area
+		void WakeInside(const Vec3& center, const Vec3& extents);
+		// Returns: The camera the region follows, the main camera when it has an owner, or null otherwise
+		static Camera* FindFocus();
+	public:
+		// Public Member Functions
+
+		// Starts tracking an object, it stays awake while it is inside of the region and goes dormant outside of it
+		// Params:
+		//	object: The object, which needs a transform
+		// Returns: Whether the object is tracked
+		bool Track(GameObject* object);
+		// Stops tracking an object and wakes it up, called by the manager when the object is cleaned up
+		// Params:
+		//	object: The object
+		void Untrack(GameObject* object);
+		// Tracks an object and puts it to sleep right away, it is woken up once it enters the region or is woken up
+		// Params:
+		//	object: The object, which needs a transform
+		void SetDormant(GameObject* object);
+		// Wakes up a tracked object, it goes dormant again if it stays outside of the region for the sleep delay
+		// Params:
+		//	object: The object
+		void Wake(GameObject* object);
+		// Wakes up every tracked object inside of an area, like around an explosion or a trigger
+		// Params:
+		//	center: The center of the area
+		//	extents: Half of the width and height of the area
+		void WakeArea(const Vec3& center, const Vec3& extents);
+		// Wakes up the dormant objects that entered the region, and puts the objects that left it to sleep
+		// Params:
+		//	dt: The time between frames
+		void Update(double dt);
+		// Wakes up and forgets every tracked object
+		void Clear();
+		// Sets the size of the region kept awake around the main camera, it stops following the camera's view
+		// Params:
+		//	extents: Half of the width and height of the region
+		void SetRegionExtents(const Vec3& extents);
+		// Makes the region follow the main camera's view again, with a margin around it
+		// Params:
+		//	margin: The margin on every side, as a fraction of the view's size, a quarter by default
+		void SetRegionMargin(float margin);
+		// Sets the size of a cell of the spatial hash, moving the dormant objects into the cells of the new size
+		// By default the cells are as wide as the region
+		// Params:
+		//	size: The size of a cell, around the size of the region works well
+		void SetCellSize(float size);
+		// Sets how long an awake object has to stay outside of the region before it goes dormant
+		// Params:
+		//	delay: The time in seconds
+		void SetSleepDelay(double delay);
+		// Sets whether every object with a transform is tracked when it is added to the manager, objects streamed in by cells are always tracked
+		// Params:
+		//	track: Whether the added objects are tracked, off by default
+		void SetTrackAdded(bool track);
+		// Returns: Whether every object with a transform is tracked when it is added to the manager
+		bool IsTrackingAdded() const;
+		// Returns: The number of dormant objects
+		size_t GetDormantCount() const;
+		// Returns: The number of tracked objects that are awake
+		size_t GetAwakeCount() const;
+
+		// Gets the classes' singleton
+		// Returns: The classes' singleton
+		static ActivationSystem& GetInstance();
+	};
+}
\ No newline at end of file
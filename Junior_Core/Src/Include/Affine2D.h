@@ -0,0 +1,161 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: Affine2D.h
+* Description: A compact 2x3 affine transformation for objects that only move, rotate and scale on the xy plane (column major order)
+* Created: 17-Oct-2026
+* Last Modified: 17-Oct-2026
+*/
+
+// Includes //
+#include <iostream>			// IO stream
+#include <cmath>			// Sine, Cosine
+#include "Vec3.h"			// Vec3
+#include "Mat3.h"			// Mat3
+
+namespace Junior
+{
+	// The top two rows of a 2D transformation, the last row is always [ 0 0 1 ]
+	// [ m00 m01 m02 ]
+	// [ m10 m11 m12 ]
+	union Affine2D
+	{
+		// Public Union Variables //
+		float m_[6];
+		struct
+		{
+			float m00_, m10_, m01_, m11_, m02_, m12_;
+		};
+	};
+
+	// Global Operators for Affine2D //
+
+	// Composes two transformations, the right one is applied first
+	// Params:
+	//	lhs: The left transformation
+	//	rhs: The right transformation
+	// Returns: The composed transformation
+	inline Affine2D operator*(const Affine2D& lhs, const Affine2D& rhs);
+	// Transforms a point, the z and w components are left as they are
+	// Params:
+	//	lhs: The transformation
+	//	rhs: The point
+	// Returns: The transformed point
+	inline Vec3 operator*(const Affine2D& lhs, const Vec3& rhs);
+	// Prints an affine transformation into a output stream
+	// Params:
+	//	stream: The stream we are printing to
+	//	affine: The transformation we are printing
+	// Returns: The output stream
+	std::ostream& operator<<(std::ostream& stream, const Affine2D& affine);
+
+	// Global Functions for Affine2D //
+
+	// Returns: The identity transformation
+	inline Affine2D AffineIdentity();
+	// Builds Translation * Rotation * Scale on the xy plane without going through any matrix products
+	// Params:
+	//	translation: The translation, only x and y are used
+	//	rotation: The rotation in radians
+	//	scaling: The scaling, only x and y are used
+	// Returns: The transformation
+	inline Affine2D AffineCompose(const Vec3& translation, float rotation, const Vec3& scaling);
+	// Transforms a direction, which ignores the translation
+	// Params:
+	//	affine: The transformation
+	//	vec: The direction
+	// Returns: The transformed direction
+	inline Vec3 TransformVector(const Affine2D& affine, const Vec3& vec);
+	// Blends two transformations entry by entry, which is close enough to blending their parts for the small changes of a single step
+	// Params:
+	//	from: The transformation at 0
+	//	to: The transformation at 1
+	//	t: How far to go from one to the other
+	// Returns: The blended transformation
+	inline Affine2D AffineLerp(const Affine2D& from, const Affine2D& to, float t);
+	// Inverts a transformation
+	// Params:
+	//	affine: The transformation
+	// Returns: The inverse, or the identity when the transformation cannot be inverted
+	Affine2D Inverse(const Affine2D& affine);
+	// Takes the xy plane part of a matrix
+	// Params:
+	//	mat: The matrix
+	// Returns: The affine transformation
+	inline Affine2D ToAffine(const Mat3& mat);
+	// Expands an affine transformation into a full matrix
+	// Params:
+	//	affine: The transformation on the xy plane
+	//	zScale: The scaling on the z axis
+	//	zTranslation: The translation on the z axis
+	// Returns: The matrix
+	inline Mat3 ToMat3(const Affine2D& affine, float zScale = 1.0f, float zTranslation = 0.0f);
+
+	// Inline Definitions //
+
+	inline Affine2D operator*(const Affine2D& lhs, const Affine2D& rhs)
+	{
+		Affine2D out;
+		out.m00_ = lhs.m00_ * rhs.m00_ + lhs.m01_ * rhs.m10_;
+		out.m10_ = lhs.m10_ * rhs.m00_ + lhs.m11_ * rhs.m10_;
+		out.m01_ = lhs.m00_ * rhs.m01_ + lhs.m01_ * rhs.m11_;
+		out.m11_ = lhs.m10_ * rhs.m01_ + lhs.m11_ * rhs.m11_;
+		out.m02_ = lhs.m00_ * rhs.m02_ + lhs.m01_ * rhs.m12_ + lhs.m02_;
+		out.m12_ = lhs.m10_ * rhs.m02_ + lhs.m11_ * rhs.m12_ + lhs.m12_;
+		return out;
+	}
+
+	inline Vec3 operator*(const Affine2D& lhs, const Vec3& rhs)
+	{
+		return Vec3(lhs.m00_ * rhs.x_ + lhs.m01_ * rhs.y_ + lhs.m02_, lhs.m10_ * rhs.x_ + lhs.m11_ * rhs.y_ + lhs.m12_, rhs.z_, rhs.w_);
+	}
+
+	inline Affine2D AffineIdentity()
+	{
+		return { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+	}
+
+	inline Affine2D AffineCompose(const Vec3& translation, float rotation, const Vec3& scaling)
+	{
+		float sine = sinf(rotation);
+		float cosine = cosf(rotation);
+		return
+		{
+			cosine * scaling.x_,	sine * scaling.x_,
+			-sine * scaling.y_,		cosine * scaling.y_,
+			translation.x_,			translation.y_,
+		};
+	}
+
+	inline Vec3 TransformVector(const Affine2D& affine, const Vec3& vec)
+	{
+		return Vec3(affine.m00_ * vec.x_ + affine.m01_ * vec.y_, affine.m10_ * vec.x_ + affine.m11_ * vec.y_, vec.z_, vec.w_);
+	}
+
+	inline Affine2D AffineLerp(const Affine2D& from, const Affine2D& to, float t)
+	{
+		Affine2D out;
+		for (unsigned i = 0; i < 6; ++i)
+		{
+			out.m_[i] = from.m_[i] + (to.m_[i] - from.m_[i]) * t;
+		}
+		return out;
+	}
+
+	inline Affine2D ToAffine(const Mat3& mat)
+	{
+		return { mat.m00_, mat.m10_, mat.m01_, mat.m11_, mat.m03_, mat.m13_ };
+	}
+
+	inline Mat3 ToMat3(const Affine2D& affine, float zScale, float zTranslation)
+	{
+		return
+		{
+			affine.m00_,	affine.m10_,	0.0f,			0.0f,
+			affine.m01_,	affine.m11_,	0.0f,			0.0f,
+			0.0f,			0.0f,			zScale,			0.0f,
+			affine.m02_,	affine.m12_,	zTranslation,	1.0f,
+		};
+	}
+}
\ No newline at end of file
@@ -5,21 +5,54 @@
  * File name: Animator.h
  * Description: Moves UV coordinates around to create animations inside sprite sheets
  * Created: 14 Feb 2019
- * Last Modified: 26 Apr 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include "Component.h"			// Component
+#include "SharedData.h"			// Shared Data
 
 namespace Junior
 {
 	// Forward Declaration
 	class MemoryManager;
 	class Sprite;
+	struct AtlasNode;
 
 	class Animator : public Component<Animator>
 	{
 	private:
+		// Private Structures
+
+		// Where the frames are inside of the texture atlas, shared between an animator and its copies until one of them changes it
+		struct Frames
+		{
+			// The number of the colums in the animation
+			unsigned numRows_;
+			// The number of rows in the animation
+			unsigned numColumns_;
+			// The atlas node the frames were measured on, null until they are measured
+			const AtlasNode* node_;
+			// The original texture x offset
+			float startXOffset_;
+			// The original texture y offset
+			float startYOffset_;
+			// The size of texture in texture coordinates (x axis)
+			float textureXSize_;
+			// The size of texture in texture coordaintes (y axis)
+			float textureYSize_;
+			// Column size in texture coordinates
+			float columnSize_;
+			// Row size in texture coordinates
+			float rowSize_;
+
+			// Constructor
+			// Params:
+			//	columns: The number of columns in the sprite sheet
+			//	rows: The number of rows in the sprite sheet
+			Frames(unsigned columns = 0, unsigned rows = 0);
+		};
+
 		// Private Member Variables
 
 		// The current frame of the animation
@@ -32,28 +65,14 @@ namespace Junior
 		unsigned start_;
 		// The end of the animation
 		unsigned end_;
-		// The number of the colums in the animation
-		unsigned numRows_;
-		// The number of rows in the animation
-		unsigned numColumns_;
 		// The timer that counts the time between frames
 		double timer_;
 		// The time in between frames
 		double timePerFrame_;
-		// The original texture x offset
-		float startXOffset_;
-		// The original texture y offset
-		float startYOffset_;
-		// The size of texture in texture coordinates (x axis)
-		float textureXSize_;
-		// The size of texture in texture coordaintes (y axis)
-		float textureYSize_;
-		// Column size in texture coordinates
-		float columnSize_;
-		// Row size in texture coordinates
-		float rowSize_;
+		// The frames of the sprite sheet
+		SharedData<Frames> frames_;
 		// The sprite component we are going to animate
-		Sprite* sprite_;
+		Handle<Sprite> sprite_;
 	public:
 		// Public Member Functions
 
@@ -62,7 +81,7 @@ namespace Junior
 		//	colums: The number of columns in the sprite sheet
 		//	rows: The number of rows in the sprite sheet
 		Animator(unsigned columns = 0, unsigned rows = 0);
-		// Copy Constructor
+		// Copy Constructor, which shares the frames with the other animator until either of them changes them
 		// Params:
 		//	other: The other animator
 		Animator(const Animator& other);
@@ -101,5 +120,12 @@ namespace Junior
 		//	parser: The parser used to read the component from the file
 		// Throws: ParserException
 		void Deserialize(Parser& parser) override;
+
+		// Public Static Functions
+
+		// Declares the component types read and written while updating
+		// Params:
+		//	access: The access being declared
+		static void DeclareAccess(ComponentAccess& access);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: ArchetypeStorage.h
+* Description: Stores the components of every object sharing the same set of component types in contiguous, per-type columns
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <vector>					// Vector
+#include <typeindex>				// Type Index
+#include <cstddef>				// Size T
+
+namespace Junior
+{
+	// Forward Declarations
+	class GameObject;
+	class ComponentContainer;
+	struct ComponentLayout;
+
+	class ArchetypeStorage
+	{
+	public:
+		// Public Structures
+
+		// The key identifying the set of component types stored, sorted so the order of the components does not matter
+		typedef std::vector<std::type_index> Key;
+
+	private:
+		// Private Structures
+
+		// A column of components of the same type
+		struct Column
+		{
+			// How the components in this column are laid out
+			const ComponentLayout* layout_;
+			// The offset, in bytes, of the column from the start of a chunk's data
+			size_t offset_;
+		};
+
+		// A fixed size block of memory holding a number of rows of every column
+		struct Chunk
+		{
+			// The memory allocated for the chunk
+			unsigned char* memory_;
+			// The aligned start of the columns inside the memory
+			unsigned char* data_;
+			// One byte per component per column, stored column by column, set when the component should be updated
+			std::vector<unsigned char> active_;
+			// The owner of each row, null when the row is free
+			std::vector<GameObject*> owners_;
+			// The number of rows that were ever handed out in this chunk, columns are only walked up to this row
+			size_t used_;
+		};
+
+		// Private Member Variables
+
+		// The set of component types stored
+		Key key_;
+		// The columns, in the order of the components of the first prototype stored
+		std::vector<Column> columns_;
+		// The chunks of memory
+		std::vector<Chunk> chunks_;
+		// The rows that were released and can be reused
+		std::vector<size_t> freeRows_;
+		// The number of rows in each chunk
+		size_t rowsPerChunk_;
+		// The number of bytes each chunk's data takes
+		size_t chunkBytes_;
+		// The biggest alignment of any of the columns
+		size_t alignment_;
+		// The number of rows currently owned by objects
+		size_t liveRows_;
+
+		// Private Member Functions
+
+		// Allocates another chunk of memory and gives its rows to the free list
+		void AddChunk();
+		// Finds the address of a component inside the storage
+		// Params:
+		//	row: The row of the component
+		//	column: The column of the component
+		// Returns: The address of the component
+		unsigned char* GetAddress(size_t row, size_t column) const;
+		// Finds which column a component of the object lives in
+		// Params:
+		//	row: The row the object lives in
+		//	component: The component we are looking for
+		// Returns: The index of the column, or the number of columns when the component is not stored here
+		size_t FindColumn(size_t row, const ComponentContainer* component) const;
+		// Hidden Copy Constructor and Assignment Operator, the chunks belong to a single storage
+		ArchetypeStorage(const ArchetypeStorage& other) = delete;
+		ArchetypeStorage& operator=(const ArchetypeStorage& other) = delete;
+	public:
+		// Public Constants
+
+		// The number of bytes of components we aim to fit in every chunk
+		static const size_t chunkTargetBytes_ = 16 * 1024;
+
+		// Public Member Functions
+
+		// Constructor
+		// Params:
+		//	prototypes: The components of the prototype object, which decide the types and order of the columns
+		ArchetypeStorage(const std::vector<ComponentContainer*>& prototypes);
+		// Destructor destroys any components still left and releases the memory
+		~ArchetypeStorage();
+		// Clones a prototype's components into a free row of the storage
+		// Params:
+		//	owner: The game object owning the new row
+		//	prototypes: The components of the prototype we are copying, must match the key of this storage
+		//	components: The list of components the clones are added to
+		// Returns: The row the components were placed in
+		size_t Insert(GameObject* owner, const std::vector<ComponentContainer*>& prototypes, std::vector<ComponentContainer*>& components);
+		// Allocates enough chunks up front for a number of rows to be inserted without allocating again
+		// Params:
+		//	rows: The number of rows about to be inserted
+		void Reserve(size_t rows);
+		// Starts updating the components of a row again after it was deactivated, detached components stay detached
+		// Params:
+		//	row: The row to activate
+		//	components: The components of the row's owner
+		void Activate(size_t row, const std::vector<ComponentContainer*>& components);
+		// Stops updating all the components of a row, the components are still alive until the row is released
+		// Params:
+		//	row: The row to deactivate
+		void Deactivate(size_t row);
+		// Stops updating a single component of a row, it stays alive until the row is released
+		// Params:
+		//	row: The row the component lives in
+		//	component: The component to detach
+		void Detach(size_t row, const ComponentContainer* component);
+		// Destroys the components of a row and makes the row available again
+		// Params:
+		//	row: The row to release
+		void Release(size_t row);
+		// Updates every active component, column by column
+		// Params:
+		//	ms: The delta time between frames
+		void Update(double ms);
+		// Updates every active component at a fixed rate, column by column
+		// Params:
+		//	ms: The fixed delta time between frames
+		void FixedUpdate(double ms);
+		// Updates the active components of one column inside a range of chunks, different chunks can be updated from different threads
+		// Params:
+		//	column: The index of the column
+		//	beginChunk: The first chunk to update
+		//	endChunk: One past the last chunk to update
+		//	ms: The delta time between frames
+		void UpdateColumn(size_t column, size_t beginChunk, size_t endChunk, double ms);
+		// Updates the active components of one column inside a range of chunks at a fixed rate
+		// Params:
+		//	column: The index of the column
+		//	beginChunk: The first chunk to update
+		//	endChunk: One past the last chunk to update
+		//	ms: The fixed delta time between frames
+		void FixedUpdateColumn(size_t column, size_t beginChunk, size_t endChunk, double ms);
+		// Returns: The number of columns
+		size_t GetColumnCount() const;
+		// Gets how the components of a column are laid out
+		// Params:
+		//	column: The index of the column
+		// Returns: The layout of the column's component type
+		const ComponentLayout& GetColumnLayout(size_t column) const;
+		// Returns: The number of chunks
+		size_t GetChunkCount() const;
+		// Returns: The set of component types stored
+		const Key& GetKey() const;
+		// Returns: The number of rows currently owned by objects
+		size_t GetLiveRows() const;
+
+		// Builds the key describing a list of components
+		// Params:
+		//	components: The components
+		// Returns: The sorted component types
+		static Key MakeKey(const std::vector<ComponentContainer*>& components);
+	};
+}
\ No newline at end of file
@@ -5,7 +5,7 @@
 * File name: Camera.h
 * Description: Holds the data for camera transformations and such as a component so that it can look at the object's transform
 * Created: 18 Feb 2019
-* Last Modified: 26 Apr 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -65,10 +65,6 @@ namespace Junior
 		Camera(const Camera& other);
 		// Initializes the component
 		void Initialize() override;
-		// Update the component
-		// Params:
-		//	dt: The time between frames
-		void Update(double dt) override;
 		// Shutsdown the component
 		void Unload() override;
 		// Updates the camera's projection matrix
@@ -99,6 +95,13 @@ namespace Junior
 		//	parser: The parser used to read the component from the file
 		// Throws: ParserException
 		void Deserialize(Parser& parser) override;
+
+		// Public Static Functions
+
+		// Declares the component types read and written while updating
+		// Params:
+		//	access: The access being declared
+		static void DeclareAccess(ComponentAccess& access);
 	};
 
 
@@ -122,7 +125,7 @@ namespace Junior
 	std::fstream& operator<<(std::fstream& stream, const ProjectionMode& mode);
 	// Reads a projection stream from a file
 	// Params:
-	//	stream: The file stream we are reading from
+	//	stream: The stream we are reading from, either a file or text that was already read
 	//	mode: The projection mode we are saving
-	void operator>>(std::fstream& stream, ProjectionMode& mode);
+	void operator>>(std::istream& stream, ProjectionMode& mode);
 }
\ No newline at end of file
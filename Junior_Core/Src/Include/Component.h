@@ -5,12 +5,15 @@
 * File name: Component.h
 * Description: Define the general component class for the rest of the others
 * Created: 28 Apr 2018
-* Last Modified: 18 Jul 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include <string>					// String
+#include <new>						// Placement New
 #include "ComponentContainer.h"		// Component Container
+#include <type_traits>				// Is Same
+#include "PoolAllocator.h"			// Pool Allocator
 #include "Parser.h"					// Parser
 
 namespace Junior
@@ -27,9 +30,8 @@ namespace Junior
 		Component(bool updatable = true)
 		{
 			owner_ = nullptr;
-			std::string fullName = typeid(T).name();
-			std::string shortName = fullName.substr(6, fullName.length());
-			name_ = shortName;
+			name_ = TypeName();
+			typeID_ = TypeID();
 			updateable_ = updatable;
 		}
 
@@ -57,10 +59,175 @@ namespace Junior
 		{
 		}
 
+// The debug allocation macro from the memory leak guard cannot be used with placement new or the allocation operators
+#pragma push_macro("new")
+#undef new
 		// Clones the component
 		ComponentContainer* Clone() const override
 		{
 			return new T(*static_cast<const T*>(this));
 		}
+
+		// Clones the component into memory that has already been allocated
+		ComponentContainer* CloneInto(void* memory) const override
+		{
+			return ::new (memory) T(*static_cast<const T*>(this));
+		}
+
+		// Takes the memory of a new component from the type's pool
+		// Params:
+		//	size: The size of the component being created
+		// Returns: The memory for the component
+		static void* operator new(size_t size)
+		{
+			// Types deriving from the component's type do not fit in the pool's blocks
+			if (size != sizeof(T))
+			{
+				return ::operator new(size);
+			}
+			return Pool().Allocate();
+		}
+
+		// Gives the memory of a component back to the type's pool
+		// Params:
+		//	memory: The memory of the component
+		//	size: The size of the component being destroyed
+		static void operator delete(void* memory, size_t size)
+		{
+			if (size != sizeof(T))
+			{
+				::operator delete(memory);
+				return;
+			}
+			Pool().Free(memory);
+		}
+
+#ifdef _DEBUG
+		// Takes the memory of a new component from the type's pool when the memory leak guard is in use
+		// Pooled components are tracked by the pool's counters instead of the debug heap
+		static void* operator new(size_t size, int, const char*, int)
+		{
+			return operator new(size);
+		}
+
+		// Gives the memory back when the constructor of a component created by the memory leak guard throws
+		static void operator delete(void* memory, int, const char*, int)
+		{
+			operator delete(memory, sizeof(T));
+		}
+#endif
+#pragma pop_macro("new")
+
+		// Returns: The pool every component of this type is allocated from
+		static PoolAllocator& Pool()
+		{
+			static PoolAllocator pool(sizeof(T), alignof(T));
+			return pool;
+		}
+
+		// Returns: How this component type is laid out in archetype storage
+		const ComponentLayout& GetLayout() const override
+		{
+			return Layout();
+		}
+
+		// Returns: The name of the component type, without the "class " prefix
+		static const std::string& TypeName()
+		{
+			static const std::string name = std::string(typeid(T).name()).substr(6);
+			return name;
+		}
+
+		// Returns: The identifier of the component type, assigned the first time the type is used
+		static ComponentTypeID TypeID()
+		{
+			static const ComponentTypeID id = RegisterType(TypeName());
+			return id;
+		}
+
+		// Returns: How this component type is laid out in archetype storage
+		static const ComponentLayout& Layout()
+		{
+			// Types that keep the empty update functions get no column functions, so their columns are never walked
+			static const ComponentLayout layout =
+			{
+				&typeid(T), sizeof(T), alignof(T),
+				OverridesUpdate() ? &UpdateColumn : nullptr,
+				OverridesFixedUpdate() ? &FixedUpdateColumn : nullptr,
+				&DestroyAt, TypeID(), &Access()
+			};
+			return layout;
+		}
+
+		// Returns: What the component type reads and writes while updating, as declared by the type's DeclareAccess
+		static const ComponentAccess& Access()
+		{
+			static const ComponentAccess access = BuildAccess();
+			return access;
+		}
+
+		// Returns: Whether the final type defines its own Update, found from the type of the member function pointer
+		static constexpr bool OverridesUpdate()
+		{
+			return !std::is_same<decltype(&T::Update), decltype(&Component<T>::Update)>::value;
+		}
+
+		// Returns: Whether the final type defines its own FixedUpdate
+		static constexpr bool OverridesFixedUpdate()
+		{
+			return !std::is_same<decltype(&T::FixedUpdate), decltype(&Component<T>::FixedUpdate)>::value;
+		}
+
+		// Declares the component types read and written while updating
+		// Types hide this function with their own, the default leaves the type updating on its own
+		// Params:
+		//	access: The access being declared
+		static void DeclareAccess(ComponentAccess& access)
+		{
+			access.exclusive_ = true;
+		}
+	private:
+		// Private Static Functions
+
+		// Builds the access of the final type, which always writes itself
+		static ComponentAccess BuildAccess()
+		{
+			ComponentAccess access;
+			T::DeclareAccess(access);
+			access.Writes(TypeID());
+			return access;
+		}
+
+		// Updates a column of components, calling the final type's function directly so the calls are not virtual
+		static void UpdateColumn(void* column, const unsigned char* active, size_t count, double ms)
+		{
+			T* components = static_cast<T*>(column);
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (active[i] && components[i].IsUpdateable())
+				{
+					components[i].T::Update(ms);
+				}
+			}
+		}
+
+		// Updates a column of components at a fixed rate
+		static void FixedUpdateColumn(void* column, const unsigned char* active, size_t count, double ms)
+		{
+			T* components = static_cast<T*>(column);
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (active[i] && components[i].IsUpdateable())
+				{
+					components[i].T::FixedUpdate(ms);
+				}
+			}
+		}
+
+		// Destroys a component without releasing its memory
+		static void DestroyAt(void* component)
+		{
+			static_cast<T*>(component)->~T();
+		}
 	};
 }
\ No newline at end of file
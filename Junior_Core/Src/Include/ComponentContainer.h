@@ -5,28 +5,127 @@
 * File name: ComponentContainer.h
 * Description: Wraps around a component
 * Created: 8 Apr 2019
-* Last Modified: 18 Jul 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
+#include <typeinfo>					// Type Info
+#include <string>					// String
+#include <vector>					// Vector
 #include "Serializable.h"			// Component
+#include "Handle.h"					// Handle ID
 
 namespace Junior
 {
 	// Forward Declarations
 	class MemoryManager;
 	class GameObject;
+	class ComponentContainer;
+
+	// The identifier given to every component type, in the order the types are first used
+	typedef unsigned ComponentTypeID;
+	// The identifier given to names that do not belong to any component type
+	const ComponentTypeID invalidComponentTypeID = static_cast<ComponentTypeID>(-1);
+
+	// The component types a component type reads and writes while it updates, so different types can update at the same time
+	// A type always writes itself, types that declare nothing are updated on their own
+	struct ComponentAccess
+	{
+		// Whether the type did not declare what it touches, and cannot update alongside any other type
+		bool exclusive_ = false;
+		// The types read while updating
+		std::vector<ComponentTypeID> reads_;
+		// The types written while updating
+		std::vector<ComponentTypeID> writes_;
+		// The shared data written while updating that is not a component, like the mesh every link writes its render job into
+		std::vector<const void*> resources_;
+
+		// Declares a type read while updating
+		// Params:
+		//	type: The identifier of the type
+		void Reads(ComponentTypeID type);
+		// Declares a type written while updating
+		// Params:
+		//	type: The identifier of the type
+		void Writes(ComponentTypeID type);
+		// Declares a type read while updating
+		template <class T>
+		void Reads()
+		{
+			Reads(T::TypeID());
+		}
+		// Declares a type written while updating
+		template <class T>
+		void Writes()
+		{
+			Writes(T::TypeID());
+		}
+		// Declares shared data written while updating that is not a component
+		// Params:
+		//	resource: The key of the data, the same for every type writing it
+		void WritesResource(const void* resource);
+		// Declares shared data written while updating that is not a component, keyed by the class of the data
+		template <class T>
+		void WritesResource()
+		{
+			static const char key = 0;
+			WritesResource(&key);
+		}
+		// Finds whether two types touch the same data, so they cannot update at the same time
+		// Params:
+		//	other: The access of the other type
+		// Returns: Whether either type writes something the other reads or writes, or both write the same shared data
+		bool ConflictsWith(const ComponentAccess& other) const;
+	};
+
+	// Describes how one component type is laid out inside of an archetype's storage
+	struct ComponentLayout
+	{
+		// The type of the component
+		const std::type_info* type_;
+		// The size of the component in bytes
+		size_t size_;
+		// The alignment of the component in bytes
+		size_t alignment_;
+		// Updates a contiguous column of components of this type, null when the type does not define Update
+		// Params:
+		//	column: The first component in the column
+		//	active: One byte per component, zero when the component should be skipped
+		//	count: The number of components in the column
+		//	ms: The delta time between frames
+		void (*updateColumn_)(void* column, const unsigned char* active, size_t count, double ms);
+		// Updates a contiguous column of components of this type at a fixed rate, null when the type does not define FixedUpdate
+		void (*fixedUpdateColumn_)(void* column, const unsigned char* active, size_t count, double ms);
+		// Destroys the component living at the address without freeing the memory
+		void (*destroy_)(void* component);
+		// The identifier of the component's type
+		ComponentTypeID typeID_;
+		// What the component type reads and writes while updating
+		const ComponentAccess* access_;
+	};
 
 	class ComponentContainer : public Serializable
 	{
 	protected:
 		// Protected Class Variables
 		bool updateable_;
+		// Whether the component lives inside of an archetype storage instead of the heap
+		bool stored_;
+		// The identifier of the component's type
+		ComponentTypeID typeID_;
 		GameObject* owner_;
 		std::string name_;
+		// The component's slot in the handle table
+		HandleID handle_;
 		// Protected Member Functions
 		// Hide the default constructor
 		ComponentContainer();
+		// Copy constructor, the copy gets its own slot in the handle table and no owner
+		// Params:
+		//	other: The component we are copying
+		ComponentContainer(const ComponentContainer& other);
+		// Hidden Assignment Operator, a component keeps the handle it was made with
+		ComponentContainer& operator=(const ComponentContainer& other) = delete;
 	public:
 		// Public Member Functions
 
@@ -49,6 +148,10 @@ namespace Junior
 		virtual void Shutdown() {};
 		// Unloads the component
 		virtual void Unload() {};
+		// Called when the owner goes dormant, components that submit work elsewhere, like rendering, should stop here
+		virtual void Sleep() {}
+		// Called when the owner wakes up from being dormant
+		virtual void Wake() {}
 		// Serializes the component
 		// Params:
 		//	parser: The parser we are using to write the component
@@ -60,15 +163,55 @@ namespace Junior
 		// Clones the component
 		// Returns: A clone of the component
 		virtual ComponentContainer* Clone() const = 0;
+		// Clones the component into memory that has already been allocated
+		// Params:
+		//	memory: Memory big and aligned enough to hold the component, as described by the layout
+		// Returns: The clone living at the memory
+		virtual ComponentContainer* CloneInto(void* memory) const = 0;
+		// Returns: How this component type is laid out in archetype storage
+		virtual const ComponentLayout& GetLayout() const = 0;
 		// Sets the component's owner
 		// Parmas:
 		//	cog: The parent we want to set this component to
 		void SetOwner(GameObject* cog);
+		// Returns: The object owning the component
+		GameObject* GetOwner() const;
 		// Get the component's type name
 		// Returns: The component type
 		const std::string GetTypeName() const;
+		// Returns: The identifier of the component's type
+		ComponentTypeID GetTypeID() const;
 		// Is the object updateable
 		// Returns: Whether the render job should be updated
 		bool IsUpdateable() const;
+		// Sets whether the component is updated, the owner drops it from its update lists when it is not
+		// Params:
+		//	updateable: Whether the component is updated
+		void SetUpdateable(bool updateable);
+		// Returns: Whether the component's type defines its own Update, components that do not are never updated
+		bool HasUpdate() const;
+		// Returns: Whether the component's type defines its own FixedUpdate
+		bool HasFixedUpdate() const;
+		// Marks whether the component lives inside of an archetype storage
+		// Params:
+		//	stored: Whether the component is owned by the storage
+		void SetStored(bool stored);
+		// Returns: Whether the component lives inside of an archetype storage, and must not be deleted
+		bool IsStored() const;
+		// Returns: The component's handle, which stops resolving once the component is destroyed
+		HandleID GetHandle() const;
+
+		// Public Static Functions
+
+		// Gives the next identifier to a component type, should only be called once per type
+		// Params:
+		//	name: The name of the component type
+		// Returns: The identifier of the component type
+		static ComponentTypeID RegisterType(const std::string& name);
+		// Finds the identifier of a component type by name using a hashed lookup
+		// Params:
+		//	name: The name of the component type
+		// Returns: The identifier of the component type, or invalidComponentTypeID when no type has the name
+		static ComponentTypeID FindTypeID(const std::string& name);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: CullingVolume.h
+* Description: The space a camera sees, used to skip drawing the quads that fall outside of it
+* Created: 17-Oct-2026
+* Last Modified: 17-Oct-2026
+*/
+
+// Includes //
+#include <cmath>			// Absolute Value
+#include <cstddef>			// Size T
+#include "Affine2D.h"		// Affine2D
+#include "Mat3.h"			// Mat3
+#include "Vec3.h"			// Vec3
+
+namespace Junior
+{
+	// The rows of a camera matrix that take a point into clip space, where everything the camera sees lies between -1 and 1
+	// Only orthographic cameras are supported, since they keep w at 1
+	struct CullingVolume
+	{
+		// Public Struct Variables //
+		// The x, y and z rows of the camera matrix
+		float rows_[3][4];
+
+		// Public Struct Functions //
+		// Constructor
+		// Params:
+		//	cameraMatrix: The projection and view matrices multiplied together
+		CullingVolume(const Mat3& cameraMatrix)
+		{
+			for (unsigned row = 0; row < 3; ++row)
+			{
+				for (unsigned column = 0; column < 4; ++column)
+				{
+					// The matrix is stored by columns
+					rows_[row][column] = cameraMatrix.m_[column * 4 + row];
+				}
+			}
+		}
+
+		// Checks whether any part of a unit quad ends up inside of the volume after being transformed
+		// The quad's corners are taken straight into clip space, so the test stays tight for rotated quads and cameras
+		// Params:
+		//	transformation: The world transformation of the quad on the xy plane
+		//	depth: The world translation of the quad on the z axis
+		// Returns: Whether the quad may be seen
+		bool IsQuadVisible(const Affine2D& transformation, float depth) const
+		{
+			bool visible = true;
+			for (unsigned row = 0; row < 3; ++row)
+			{
+				const float* r = rows_[row];
+				float center = r[0] * transformation.m02_ + r[1] * transformation.m12_ + r[2] * depth + r[3];
+				// The corners sit half a unit away from the center along both of the quad's axes
+				float extent = 0.5f * (std::fabs(r[0] * transformation.m00_ + r[1] * transformation.m10_)
+					+ std::fabs(r[0] * transformation.m01_ + r[1] * transformation.m11_));
+				visible &= std::fabs(center) - extent <= 1.0f;
+			}
+			return visible;
+		}
+
+#ifdef JUNIOR_MATH_SSE
+		// Checks four quads at once, the same way as IsQuadVisible, with one quad in each lane
+		// Params:
+		//	quads: The first quad, an Affine2D directly followed by the depth, like a render job
+		//	stride: The number of bytes from one quad to the next
+		// Returns: A bit for each quad, the first quad in the lowest bit, set when the quad may be seen
+		int AreQuadsVisible(const unsigned char* quads, size_t stride) const
+		{
+			// Each quad loads as its two axes and as its translation, depth and whatever comes next
+			// Transposing the loads gives one vector per component, holding that component of all four quads
+			__m128 m00 = _mm_loadu_ps(reinterpret_cast<const float*>(quads));
+			__m128 m10 = _mm_loadu_ps(reinterpret_cast<const float*>(quads + stride));
+			__m128 m01 = _mm_loadu_ps(reinterpret_cast<const float*>(quads + stride * 2));
+			__m128 m11 = _mm_loadu_ps(reinterpret_cast<const float*>(quads + stride * 3));
+			_MM_TRANSPOSE4_PS(m00, m10, m01, m11);
+			__m128 m02 = _mm_loadu_ps(reinterpret_cast<const float*>(quads) + 4);
+			__m128 m12 = _mm_loadu_ps(reinterpret_cast<const float*>(quads + stride) + 4);
+			__m128 depth = _mm_loadu_ps(reinterpret_cast<const float*>(quads + stride * 2) + 4);
+			__m128 unused = _mm_loadu_ps(reinterpret_cast<const float*>(quads + stride * 3) + 4);
+			_MM_TRANSPOSE4_PS(m02, m12, depth, unused);
+
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			const __m128 half = _mm_set1_ps(0.5f);
+			const __m128 one = _mm_set1_ps(1.0f);
+			__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (unsigned row = 0; row < 3; ++row)
+			{
+				const float* r = rows_[row];
+				__m128 r0 = _mm_set1_ps(r[0]);
+				__m128 r1 = _mm_set1_ps(r[1]);
+				__m128 center = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(r0, m02), _mm_mul_ps(r1, m12)), _mm_mul_ps(_mm_set1_ps(r[2]), depth)), _mm_set1_ps(r[3]));
+				__m128 extentX = _mm_andnot_ps(signMask, _mm_add_ps(_mm_mul_ps(r0, m00), _mm_mul_ps(r1, m10)));
+				__m128 extentY = _mm_andnot_ps(signMask, _mm_add_ps(_mm_mul_ps(r0, m01), _mm_mul_ps(r1, m11)));
+				__m128 extent = _mm_mul_ps(half, _mm_add_ps(extentX, extentY));
+				visible = _mm_and_ps(visible, _mm_cmple_ps(_mm_sub_ps(_mm_andnot_ps(signMask, center), extent), one));
+			}
+			return _mm_movemask_ps(visible);
+		}
+#endif
+
+		// Checks whether any part of an axis aligned square ends up inside of the volume
+		// Params:
+		//	center: The center of the square in world space
+		//	size: The length of the square's sides
+		// Returns: Whether the square may be seen
+		bool IsSquareVisible(const Vec3& center, float size) const
+		{
+			bool visible = true;
+			for (unsigned row = 0; row < 3; ++row)
+			{
+				const float* r = rows_[row];
+				float clipCenter = r[0] * center.x_ + r[1] * center.y_ + r[2] * center.z_ + r[3];
+				float extent = 0.5f * size * (std::fabs(r[0]) + std::fabs(r[1]));
+				visible &= std::fabs(clipCenter) - extent <= 1.0f;
+			}
+			return visible;
+		}
+	};
+}
\ No newline at end of file
@@ -5,30 +5,97 @@
  * File name: DefaultMesh.h
  * Description: The default mesh that objects use when they don't specify a particular mesh
  * Created: 2 May 2019
- * Last Modified: 2 May 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include <Mesh.h>
 #include "RenderJob.h"			// Render Job
+#include "InstanceRingBuffer.h"	// Instance Ring Buffer
 
 namespace Junior
 {
 	class DefaultMesh : public Mesh
 	{
 	private:
+		// Private Structures
+
+		// Where a handle's render job is inside of the packed array
+		struct JobSlot
+		{
+			// The index of the render job
+			size_t index_;
+			// Increased every time the render job is released, so older handles stop resolving
+			unsigned generation_;
+		};
+
 		// Private Static Member Functions
-		// The number of attributes we have in this class
-		const static unsigned NUM_ATTRIBUTES = 5;
+		// The index of the last attribute we have in this class, counted from the mesh's first extra attribute
+		const static unsigned NUM_ATTRIBUTES = 4;
+		// Culled render jobs between drawn ones are drawn anyway when there are this few of them, so the draw calls are not split up too much
+		const static size_t MAX_CULLING_GAP = 16;
+
+		// Private Member Functions
+
+		// The buffer the changed render jobs are written into every frame
+		InstanceRingBuffer instanceBuffer_;
+		// The render jobs packed together, the visible ones first so they can be uploaded as they are
+		std::vector<RenderJob> renderJobs_;
+		// The slot of the indirection table pointing at every render job
+		std::vector<unsigned> jobSlots_;
+		// The regions of the instance buffer still holding an old copy of every render job, one bit per region
+		// Every render job has its own byte, so links updating on different threads never write the same memory
+		std::vector<unsigned char> staleRegions_;
+		// The indirection table from the handles to the render jobs
+		std::vector<JobSlot> slots_;
+		// The slots that are not pointing at a render job
+		std::vector<unsigned> freeSlots_;
+		// The number of render jobs at the front of the array that are drawn when they are on screen
+		size_t visibleCount_;
+		// Whether every visible render job is drawn this frame, written by culling
+		std::vector<unsigned char> drawnJobs_;
+		// The indices of the visible render jobs ordered by depth, kept between draws so sorting does not allocate
+		std::vector<size_t> depthOrder_;
+		// The visible render jobs as they were before sorting, kept between draws as well
+		std::vector<RenderJob> unsortedJobs_;
+		// The slots of the visible render jobs as they were before sorting
+		std::vector<unsigned> unsortedSlots_;
+		// The number of render jobs drawn during the last draw
+		size_t drawnCount_;
+		// The number of visible render jobs the last draw skipped since they were off screen
+		size_t culledCount_;
+		// The number of bytes of render jobs written during the last draw
+		size_t bytesUploaded_;
+		// The number of bytes of render jobs the last draw did not have to write since they had not changed
+		size_t bytesSaved_;
+		// The number of times the last draw waited for the GPU to finish with the buffer
+		unsigned fenceStalls_;
 
 		// Private Member Functions
 
-		// The buffer object for the render jobs
-		unsigned jobsBufferObject_;
-		// A vector that holds the extra data of all of the objects that are using it
-		std::vector<RenderJob*> renderJobs_;
-		// The vector that translates our render jobs from poiners to actual data
-		std::vector<RenderJob> readyToRenderJobs_;
+		// Marks every region of the instance buffer as holding an old copy of a render job
+		// Params:
+		//	index: The index of the render job
+		void MarkDirty(size_t index);
+		// Swaps two render jobs inside of the packed array, keeping their slots pointing at them
+		// Params:
+		//	first: The index of the first render job
+		//	second: The index of the second render job
+		void SwapJobs(size_t first, size_t second);
+		// Finds the index of a handle's render job
+		// Params:
+		//	handle: The handle
+		//	index: The index of the render job
+		// Returns: Whether the handle still refers to a render job
+		bool FindJob(RenderJobHandle handle, size_t& index) const;
+		// Orders the visible render jobs by depth so the sprites blend back to front, only the jobs that moved are uploaded again
+		void SortJobs();
+		// Marks which of the visible render jobs are on the main camera's screen, filling the short gaps between them
+		void CullJobs();
+		// Points the render job attributes at a region of the instance buffer
+		// Params:
+		//	offset: The offset of the region in bytes
+		void PointAttributes(size_t offset);
 
 	public:
 		// Public Member Functions
@@ -37,18 +104,45 @@ namespace Junior
 		DefaultMesh();
 		// Virtual Destructor
 		~DefaultMesh() override;
-		// Draws the mesh to OpenGL
+		// Draws the mesh to OpenGL, the render jobs with lower depths first
 		// Params:
 		//	shaderID: The shader id we are using
 		void Draw(unsigned shaderID) override;
-		// Assigns a new render job
-		// Returns: The new render job we just assigned
-		RenderJob* GetNewRenderJob();
-		// Removes a render job from the mesh
+		// Makes a new visible render job
+		// Returns: The handle to the render job
+		RenderJobHandle CreateRenderJob();
+		// Finds a render job
+		// Params:
+		//	handle: The handle to the render job
+		// Returns: The render job, which may move once any render job is created, hidden, shown or released, or null when it was released
+		const RenderJob* GetRenderJob(RenderJobHandle handle) const;
+		// Changes a render job, it is only uploaded again when the new data is different
+		// Params:
+		//	handle: The handle to the render job
+		//	job: The new data of the render job
+		void SetRenderJob(RenderJobHandle handle, const RenderJob& job);
+		// Shows or hides a render job, hidden render jobs keep their data but are not drawn
+		// Params:
+		//	handle: The handle to the render job
+		//	visible: Whether the render job is drawn
+		void SetRenderJobVisible(RenderJobHandle handle, bool visible);
+		// Releases a render job, the handle stops resolving
 		// Params:
-		//	renderJob: The render job we are trying to remove
-		void RemoveRenderJob(const RenderJob* renderJob);
+		//	handle: The handle to the render job
+		void ReleaseRenderJob(RenderJobHandle handle);
 		// Clears all of the render jobs we have
 		void ClearJobs();
+		// Returns: The number of render jobs that are drawn when they are on screen
+		size_t GetVisibleJobCount() const;
+		// Returns: The number of render jobs drawn during the last draw
+		size_t GetDrawnJobCount() const;
+		// Returns: The number of visible render jobs the last draw skipped since they were off screen
+		size_t GetCulledJobCount() const;
+		// Returns: The number of bytes of render jobs written during the last draw
+		size_t GetBytesUploaded() const;
+		// Returns: The number of bytes of render jobs the last draw did not have to write since they had not changed
+		size_t GetBytesSaved() const;
+		// Returns: The number of times the last draw waited for the GPU to finish with the buffer
+		unsigned GetFenceStallCount() const;
 	};
 }
\ No newline at end of file
@@ -5,16 +5,17 @@
 * File name: DefaultMeshLink.h
 * Description: Links this game object to the DefaultMesh to render it on screen
 * Created: 4 May 2018
-* Last Modified: 4 May 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include "Component.h"		// Components
+#include "RenderJob.h"		// Render Job Handle
 
 namespace Junior
 {
 	// Forward Declarations
-	struct RenderJob;
+	class DefaultMesh;
 	class Transform;
 	class Sprite;
 
@@ -27,12 +28,14 @@ namespace Junior
 		const char* defaultProgramDir;
 		// Private Member Variables
 
+		// The mesh drawing the render job, null when the link has no render job
+		DefaultMesh* mesh_;
 		// The job that takes care of the rendering data
-		RenderJob* renderJob_;
+		RenderJobHandle renderJob_;
 		// The game object's transform
-		Transform* transform_;
+		Handle<Transform> transform_;
 		// The game object's sprite
-		Sprite* sprite_;
+		Handle<Sprite> sprite_;
 
 	public:
 		// Public Member Functions
@@ -53,5 +56,16 @@ namespace Junior
 		void Update(double dt) override;
 		// Unloads the component
 		void Unload() override;
+		// Takes the render job out of the mesh while the owner is dormant
+		void Sleep() override;
+		// Puts the render job back into the mesh
+		void Wake() override;
+
+		// Public Static Functions
+
+		// Declares the component types read and written while updating
+		// Params:
+		//	access: The access being declared
+		static void DeclareAccess(ComponentAccess& access);
 	};
 }
\ No newline at end of file
@@ -3,18 +3,20 @@
 * Email: david.wongcascante@digipen.edu
 * File name: DrawProgram.h
 * Date Created: 26 Apr 2018
-* Last Modified: 6 May 2019
+* Last Modified: 17 Oct 2026
 * Description: Declare what a Draw Program is
 */
 
 // Includes //
 #include <vector>		// Vector
+#include <typeinfo>		// Type Info
 #include "Resource.h"	// Resource
 
 namespace Junior
 {
 	// Forward Declarations
 	class Mesh;
+	class RenderQueue;
 
 	class DrawProgram : public Resource
 	{
@@ -51,8 +53,11 @@ namespace Junior
 		// Params:
 		//	fileDir: the directory where the shader files are found
 		void LoadFromDisk(const std::string& fileDir) override;
-		// Draw all of the meshes in the shader
-		void Draw();
+		// Adds the draw commands of all of the meshes in the shader to the render queue
+		// Params:
+		//	queue: The render queue
+		//	order: Where the program is drawn compared to the other programs in the same layer
+		void Submit(RenderQueue& queue, unsigned order);
 		// Cleans up any resources left in this shader
 		void CleanUp() override;
 		// Adds a mesh to the draw program
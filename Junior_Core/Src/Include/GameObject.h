@@ -5,13 +5,16 @@
 * File name: GameObject.h
 * Description: Define what a Game Object looks like
 * Created: 28 Apr 2018
-* Last Modified: 18 Jul 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes //
 #include <vector>					// Vector
 #include <typeinfo>					// Type Info
 #include "Serializable.h"			// Serializable
+#include "ComponentContainer.h"		// Component Type ID
+#include "PoolAllocator.h"			// Pool Allocator
+#include "Handle.h"					// Handle ID
 
 namespace Junior
 {
@@ -19,15 +22,25 @@ namespace Junior
 	class GameObject;
 	class MemoryManager;
 	class ComponentContainer;
+	class ArchetypeStorage;
 	class Parser;
 	struct RenderJob;
 
+	// The identifier given to every object name, in the order the names are first used
+	typedef unsigned NameID;
+	// The identifier given to names that no object has used
+	const NameID invalidNameID = static_cast<NameID>(-1);
+
 	class GameObject : public Serializable
 	{
+		// Friend Classes
+		friend class GameObjectManager;
 	private:
 		// Private Class Variables //
 		// The name of the object
 		std::string name_;
+		// The interned identifier of the object's name
+		NameID nameID_;
 		// The parent of this game bject
 		GameObject* parent_;
 		// If this game object is destroyed or not
@@ -38,7 +51,73 @@ namespace Junior
 		std::vector<ComponentContainer*> components_;
 		// The children of this game object
 		std::vector<GameObject*> children_;
+		// The archetype storage holding this object's stored components, null when every component lives on the heap
+		ArchetypeStorage* archetype_;
+		// The row of this object inside of the archetype storage
+		size_t archetypeRow_;
+		// The number of components living inside of the archetype storage
+		size_t storedComponents_;
+		// One bit per component type this object has, for the types with an identifier below maxIndexedTypes_
+		unsigned long long signature_;
+		// The first component of every type in the signature, sorted by type identifier
+		// The component of a type is found at the number of bits set in the signature below the type's bit
+		std::vector<ComponentContainer*> indexed_;
+		// The index of this object inside of the manager's list of objects, unmanagedIndex_ when the manager does not own it
+		size_t managerIndex_;
+		// The object's slot in the handle table
+		HandleID handle_;
+		// The index of this object inside of the manager's list of objects sharing its name
+		size_t nameSlot_;
+		// The components living on the heap whose types define Update, and are marked for updating
+		std::vector<ComponentContainer*> updating_;
+		// The components living on the heap whose types define FixedUpdate, and are marked for updating
+		std::vector<ComponentContainer*> fixedUpdating_;
+		// Whether the object is sleeping, sleeping objects are left out of every update
+		bool sleeping_;
+		// Whether the object is loaded with its level file, instead of streamed in by cells
+		bool alwaysLoaded_;
+		// The index of this object inside of the manager's list of updating objects, unmanagedIndex_ when it is not listed
+		size_t updateSlot_;
+		// The index of this object inside of the manager's list of objects updating at a fixed rate
+		size_t fixedUpdateSlot_;
+
+		// Private Constants
+
+		// The manager index of objects that are not owned by the manager
+		static const size_t unmanagedIndex_ = static_cast<size_t>(-1);
+
+		// Private Member Functions
+
+		// Adds the component to the typed lookup if it is the first of its type
+		// Params:
+		//	component: The component to add
+		void IndexComponent(ComponentContainer* component);
+		// Removes the component from the typed lookup, promoting the next component of the same type if there is one
+		// Params:
+		//	component: The component to remove, it must have already been taken out of the components list
+		void UnindexComponent(ComponentContainer* component);
+		// Finds a component whose type is too big to fit in the signature
+		// Params:
+		//	id: The identifier of the type
+		// Returns: The first component with the type
+		ComponentContainer* FindUnindexed(ComponentTypeID id) const;
+		// Counts the number of bits set
+		// Params:
+		//	bits: The bits to count
+		// Returns: The number of bits set
+		static unsigned CountBits(unsigned long long bits)
+		{
+			bits = bits - ((bits >> 1) & 0x5555555555555555ull);
+			bits = (bits & 0x3333333333333333ull) + ((bits >> 2) & 0x3333333333333333ull);
+			bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+			return static_cast<unsigned>((bits * 0x0101010101010101ull) >> 56);
+		}
 	public:
+		// Public Constants
+
+		// The number of component types that can be looked up through the signature
+		static const ComponentTypeID maxIndexedTypes_ = 64;
+
 		// Public Member Functions //
 		// Constructor
 		// Params:
@@ -50,15 +129,20 @@ namespace Junior
 		// Params:
 		//	other: The other game object we are copying from
 		GameObject(const GameObject& other);
+		// Copy Constructor - Copies the game object, placing the copies of its components inside of an archetype storage
+		// Params:
+		//	other: The other game object we are copying from
+		//	storage: The storage the components are placed in, must have been made for the other object's component types
+		GameObject(const GameObject& other, ArchetypeStorage& storage);
 		// Destructor destroys the game object
 		~GameObject();
 		// Initalizes all of the components inside of it
 		void Initialize();
-		// Updates the components of the game object
+		// Updates the components of the game object, the ones inside archetype storage are updated by the storage instead
 		// Params:
 		//	ms: The delta time between frames
 		void Update(double ms);
-		// Updates the components of the game object at constant dt
+		// Updates the components of the game object at constant dt, the ones inside archetype storage are updated by the storage instead
 		// Params:
 		//	ms: The delta time between frames
 		void FixedUpdate(double ms);
@@ -95,37 +179,107 @@ namespace Junior
 		//	name: The new name of the game object
 		void SetName(const std::string& name);
 		// Returns: The name of the game object
-		std::string GetName() const;
+		const std::string& GetName() const;
+		// Returns: The interned identifier of the object's name
+		NameID GetNameID() const;
+		// Returns: The object's handle, which stops resolving once the object is deleted
+		HandleID GetHandle() const;
 		// Returns: The parent of this game object
 		GameObject* GetParent() const;
 		// Returns: The children in a list
 		const std::vector<GameObject*>& GetChildren() const;
+		// Returns: The components in a list
+		const std::vector<ComponentContainer*>& GetComponents() const;
 		// Gives a pointer to a selected component
 		// Params:
-		//	type: The type of component we are looking for
+		//	name: The type name of component we are looking for, found through a hashed type identifier
 		// Returns: The first component in the list of components with the desired component type
 		ComponentContainer* GetComponent(const std::string& name) const;
 		// Gives a pointer to a selected component
-		template <class T>
-		T* GetComponent()
+		// Params:
+		//	id: The identifier of the component type
+		// Returns: The first component with the type, or null when the object has none
+		ComponentContainer* GetComponent(ComponentTypeID id) const
 		{
-			// Search through each component to see if we found a component with the correct type
-			auto end = components_.end();
-			for (auto begin = components_.begin(); begin < end; ++begin)
+			if (id < maxIndexedTypes_)
 			{
-				if (typeid(**begin) == typeid(T) || dynamic_cast<T*>(*begin))
+				unsigned long long bit = 1ull << id;
+				if (!(signature_ & bit))
 				{
-					return static_cast<T*>(*begin);
+					return nullptr;
 				}
+				return indexed_[CountBits(signature_ & (bit - 1))];
 			}
 
-			return nullptr;
+			return FindUnindexed(id);
 		}
-		// Destroys the game object
+		// Gives a pointer to a selected component
+		// Returns: The first component with the exact type T, or null when the object has none
+		template <class T>
+		T* GetComponent() const
+		{
+			return static_cast<T*>(GetComponent(T::TypeID()));
+		}
+		// Rebuilds the lists of components updated through this object, called when a component is added, removed or marked
+		void RefreshUpdateLists();
+		// Returns: The components updated through this object
+		const std::vector<ComponentContainer*>& GetUpdatingComponents() const;
+		// Returns: The components updated through this object at a fixed rate
+		const std::vector<ComponentContainer*>& GetFixedUpdatingComponents() const;
+		// Puts the object to sleep or wakes it up, a sleeping object drops out of every update until it is woken up
+		// The components are told through Sleep and Wake, so they can stop submitting work like rendering
+		// Params:
+		//	sleeping: Whether the object sleeps
+		void SetSleeping(bool sleeping);
+		// Returns: Whether the object is sleeping
+		bool IsSleeping() const;
+		// Marks the object as loaded with its level file instead of streamed in by cells, so it is left out when the level's cells are saved
+		// Params:
+		//	alwaysLoaded: Whether the object is always loaded
+		void SetAlwaysLoaded(bool alwaysLoaded);
+		// Returns: Whether the object is loaded with its level file instead of streamed in by cells
+		bool IsAlwaysLoaded() const;
+		// Destroys the game object and its children, the manager cleans up the objects it owns at the end of the frame
 		void Destroy();
 		// Returns: Whether the object is destroyed
 		bool IsDestroyed();
 		// Returns: Whether this object is an archetype or not
 		bool IsArchetype();
+
+		// Public Static Functions
+
+// The debug allocation macro from the memory leak guard cannot be used with the allocation operators
+#pragma push_macro("new")
+#undef new
+		// Takes the memory of a new object from the object pool
+		// Params:
+		//	size: The size of the object being created
+		// Returns: The memory for the object
+		static void* operator new(size_t size);
+		// Gives the memory of an object back to the object pool
+		// Params:
+		//	memory: The memory of the object
+		//	size: The size of the object being destroyed
+		static void operator delete(void* memory, size_t size);
+#ifdef _DEBUG
+		// Takes the memory of a new object from the object pool when the memory leak guard is in use
+		// Pooled objects are tracked by the pool's counters instead of the debug heap
+		static void* operator new(size_t size, int blockType, const char* file, int line);
+		// Gives the memory back when the constructor of an object created by the memory leak guard throws
+		static void operator delete(void* memory, int blockType, const char* file, int line);
+#endif
+#pragma pop_macro("new")
+		// Returns: The pool every object is allocated from
+		static PoolAllocator& GetPool();
+		// Gives an identifier to a name, or the identifier it was already given
+		// Params:
+		//	name: The name
+		// Returns: The identifier of the name
+		static NameID InternName(const std::string& name);
+		// Finds the identifier of a name through a hashed lookup, without interning it
+		// Params:
+		//	name: The name
+		// Returns: The identifier of the name, or invalidNameID when no object has used the name
+		static NameID FindNameID(const std::string& name);
 	};
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
 * File name: GameObjectFactory.cpp
 * Description: Constructs game objects and components from files
 * Created: 9 Apr 2019
-* Last Modified: 3 Sep 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -32,6 +32,10 @@ namespace Junior
 		std::string objectFileExtension_;
 		// File extensions for levels
 		std::string levelFileExtenion_;
+		// File extension for the cells of a streamed level
+		std::string cellFileExtension_;
+		// File extension for the list of cells of a streamed level
+		std::string cellIndexExtension_;
 
 		// Private Member Functions
 
@@ -71,6 +75,30 @@ namespace Junior
 		// Params:
 		//	name: The name of the level we are filling
 		void FillLevel(const std::string& name) const;
+		// Reads a single object of a level, either the whole object or the name of an archetype
+		// Params:
+		//	parser: The parser, right before the name of the object
+		// Returns: The object, which still has to be added to the manager, or null when the archetype was not found
+		// Throws: ParserException
+		GameObject* ReadObject(Parser& parser) const;
+		// Fills a level with the objects that are always loaded, then streams the rest of it in by cells around the camera
+		// Params:
+		//	name: The name of the level we are streaming
+		void StreamLevel(const std::string& name) const;
+		// Splits the objects with a transform into cells and saves every cell to its own file, along with the list of cells
+		// Cameras and the objects marked as always loaded, like the ones read from the level file, are left out of the cells
+		// Clear the mark on objects read from a level file that should be streamed in by cells instead
+		// Params:
+		//	name: The name of the level the cells belong to
+		//	cellSize: The size of a cell in world units
+		void SaveLevelCells(const std::string& name, float cellSize) const;
+		// Finds the file of a cell of a streamed level
+		// Params:
+		//	name: The name of the level
+		//	x: The cell's column
+		//	y: The cell's row
+		// Returns: The path to the cell's file
+		std::string GetCellFilePath(const std::string& name, int x, int y) const;
 		// Returns: The instance of the game object factory
 		static GameObjectFactory& GetInstance();
 	};
@@ -5,13 +5,20 @@
 * File name: GameObjectManager.h
 * Description: Takes care to initialize, update, and clean up all of the objects
 * Created: 11 Dec 2018
-* Last Modified: 10 Sep 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes //
 #include <vector>				// Vector
 #include <string>				// String
+#include <map>					// Map
+#include <unordered_map>		// Unordered Map
+#include <mutex>				// Mutex
+#include <functional>			// Function
 #include "GameSystem.h"			// Game System
+#include "ArchetypeStorage.h"	// Archetype Storage
+#include "UpdatePhases.h"		// Update Phases
+#include "GameObject.h"			// Name ID
 
 namespace Junior
 {
@@ -19,30 +26,155 @@ namespace Junior
 	class GameObject;
 	class MemoryManager;
 
+	// How the components of objects created from archetypes are stored
+	enum StorageMode
+	{
+		// Every component is allocated on its own, and updated through its object
+		OBJECT_STORAGE,
+		// Components of objects sharing the same component types are stored in contiguous columns, and updated column by column
+		ARCHETYPE_STORAGE,
+	};
+
+	// How the objects are updated every frame
+	enum UpdateMode
+	{
+		// Every object updates its components in order, one object after another
+		SERIAL_UPDATE,
+		// The objects are split between the job system's workers, every object updates its components in order
+		// Falls back to the serial update while any transform has a parent, since a transform touches its parent and children
+		OBJECT_PARALLEL_UPDATE,
+		// Every component type is updated for all objects at once, types that do not conflict are updated at the same time
+		PHASED_UPDATE,
+	};
+
+	// Called on every object of a batch after it is created and before it is initialized
+	// Params:
+	//	object: The new object
+	//	index: The index of the object inside of the batch
+	typedef std::function<void(GameObject* object, size_t index)> SpawnFunction;
+
 	class GameObjectManager : public GameSystem
 	{
 	private:
+		// Private Structures
 
-		// Private Member Constants
-
-		// The fixed delta time we are targetting
-		const double fixedDtTarget_;
+		// The objects having every component type of a signature, kept up to date as objects and components come and go
+		struct ComponentQuery
+		{
+			// The matching objects, in no particular order
+			std::vector<GameObject*> objects_;
+			// The index of every matching object inside of the list
+			std::unordered_map<const GameObject*, size_t> slots_;
+		};
 
 		// Private Member Variables
 
+		// The fixed delta time we are targetting
+		double fixedDtTarget_;
 		// The fixed delta time accumulator that runs fixed update
 		double fixedDtAccumulator_;
+		// The most fixed updates run in a single frame, the time past them is dropped instead of piling up
+		unsigned maxSubsteps_;
+		// The number of fixed updates run during the last frame
+		unsigned substepsLastFrame_;
+		// The simulation time dropped during the last frame for going over the most fixed updates
+		double droppedTime_;
+		// How far the accumulator is between the last fixed update and the next one, from 0 to 1
+		float interpolationAlpha_;
 		// The game objects
 		std::vector<GameObject*> gameObjects_;
 		// The archetypes for these objects
 		std::vector<GameObject*> archetypes_;
-		// The destroyed game objects
+		// The objects sharing every name, in the order they were added
+		std::unordered_map<NameID, std::vector<GameObject*>> objectsByName_;
+		// The identifier of every name objects and archetypes were added with, so finding them by name never locks the name registry
+		std::unordered_map<std::string, NameID> nameIDs_;
+		// The first archetype added with every name
+		std::unordered_map<NameID, GameObject*> archetypesByName_;
+		// The objects destroyed this frame, cleaned up at the end of the frame
 		std::vector<GameObject*> destroyedObjects_;
+		// Locks the destroyed objects, objects may be destroyed from the job system's workers
+		std::mutex destroyedMutex_;
+		// How the components of objects created from archetypes are stored
+		StorageMode storageMode_;
+		// The storages for every set of component types, created when first needed
+		mutable std::map<ArchetypeStorage::Key, ArchetypeStorage*> storages_;
+		// How the objects are updated every frame
+		UpdateMode updateMode_;
+		// The component types grouped into waves for the phased update
+		UpdatePhases phases_;
+		// The component types grouped into waves for the phased fixed update
+		UpdatePhases fixedPhases_;
+		// Whether the updating objects or the storages changed since the phases were last built
+		bool phasesDirty_;
+		// Whether the fixed updating objects or the storages changed since the fixed phases were last built
+		bool fixedPhasesDirty_;
+		// The awake objects with components to update, in no particular order
+		std::vector<GameObject*> updatingObjects_;
+		// The awake objects with components to update at a fixed rate, in no particular order
+		std::vector<GameObject*> fixedUpdatingObjects_;
+		// The matching objects of every signature queried so far
+		std::unordered_map<unsigned long long, ComponentQuery> queries_;
 
 		// Private Member Functions
 
 		// Default Constructor
 		GameObjectManager();
+		// Makes the phased update and fixed update build their waves again before they next run
+		void MarkPhasesDirty();
+		// Updates every object that is not destroyed, and the stored components column by column
+		// Params:
+		//	dt: The delta time between frames
+		void UpdateObjects(double dt);
+		// Updates every object and the stored components at a fixed rate
+		// Params:
+		//	dt: The fixed delta time
+		void FixedUpdateObjects(double dt);
+		// Adds an object to the list of objects sharing its name
+		// Params:
+		//	object: The object
+		void IndexName(GameObject* object);
+		// Takes an object out of the list of objects sharing a name, keeping the order of the objects left
+		// Params:
+		//	object: The object
+		//	name: The name the object was listed under
+		void UnindexName(GameObject* object, NameID name);
+		// Closes up the holes left in the list of objects sharing a name, keeping the order of the objects left
+		// Params:
+		//	name: The name whose list is closed up
+		void CompactName(NameID name);
+		// Finds the query of a signature, building it from every object the first time the signature is used
+		// Params:
+		//	signature: One bit for every component type the objects must have
+		// Returns: The query
+		ComponentQuery& GetQuery(unsigned long long signature);
+		// Adds an object to every query its signature matches, and takes it out of the ones it no longer matches
+		// Params:
+		//	object: The object
+		//	oldSignature: The signature the queries last saw the object with, zero for objects new to the manager
+		//	newSignature: The object's current signature, zero for objects leaving the manager
+		void UpdateQueries(GameObject* object, unsigned long long oldSignature, unsigned long long newSignature);
+		// Finds the storage for an archetype's component types, or makes one if this is the first object with them
+		// Params:
+		//	archetype: The archetype
+		// Returns: The storage
+		ArchetypeStorage& GetStorage(const GameObject* archetype) const;
+		// Creates an object from an archetype, using the current storage mode
+		// Params:
+		//	archetype: The archetype
+		// Returns: The new object
+		GameObject* Instantiate(const GameObject* archetype) const;
+		// Adds an object to an update list, or takes it out moving the last object into its place
+		// Params:
+		//	list: The update list
+		//	slot: The member of the object holding its index inside of the list
+		//	object: The object
+		//	listed: Whether the object should be in the list
+		static void SetListed(std::vector<GameObject*>& list, size_t GameObject::* slot, GameObject* object, bool listed);
+		// Places an initialized object into the manager's list and lookups
+		// Params:
+		//	object: The object
+		void Register(GameObject* object);
 	public:
 		// Loads the game object manager
 		// Returns: Whether the game object manager succeded in loading
@@ -71,21 +203,174 @@ namespace Junior
 		// Params:
 		//	archetype: The archetype we want to initialize
 		void AddArchetype(GameObject* const archetype);
-		// Finds an object by name
+		// Queues a destroyed object to be cleaned up at the end of the frame, called by the object when it is destroyed
+		// Params:
+		//	object: The destroyed object
+		void QueueDestroy(GameObject* object);
+		// Removes every destroyed object from the manager, then shuts down, unloads and deletes them together
+		// Called at the end of every update, objects destroyed while cleaning up are cleaned up as well
+		void CollectDestroyed();
+		// Moves a renamed object to the list of its new name, called by the object when its name changes
+		// Params:
+		//	object: The renamed object
+		//	oldName: The name the object had before
+		void RenameObject(GameObject* object, NameID oldName);
+		// Moves a renamed archetype to its new name, called by the archetype when its name changes
+		// Params:
+		//	archetype: The renamed archetype
+		//	oldName: The name the archetype had before
+		void RenameArchetype(GameObject* archetype, NameID oldName);
+		// Finds an object by name through a hashed lookup
 		// Params:
 		//	name: The name of the object we are looking for
-		// Returns: The object with the same name
+		// Returns: The first object added with the name that is still alive, or null when there is none
 		GameObject* FindByName(const std::string& name) const;
+		// Finds an object by the identifier of its name
+		// Params:
+		//	name: The identifier of the name
+		// Returns: The first object added with the name that is still alive, or null when there is none
+		GameObject* FindByName(NameID name) const;
+		// Finds every object sharing a name
+		// Params:
+		//	name: The name of the objects we are looking for
+		// Returns: The objects with the name in the order they were added, valid until an object is added, renamed or removed
+		const std::vector<GameObject*>& FindAllByName(const std::string& name) const;
+		// Finds every object sharing the identifier of a name
+		// Params:
+		//	name: The identifier of the name
+		// Returns: The objects with the name in the order they were added, valid until an object is added, renamed or removed
+		const std::vector<GameObject*>& FindAllByName(NameID name) const;
 		// Creates an archetype by name
 		// Params:
 		//	name: The name of the object we want to create
 		// Returns: A game object related to the archetype
 		GameObject* CreateFromArchetype(const std::string& name) const;
+		// Creates an archetype by the identifier of its name
+		// Params:
+		//	name: The identifier of the name
+		// Returns: A game object related to the archetype, or null when no archetype has the name
+		GameObject* CreateFromArchetype(NameID name) const;
+		// Creates and adds a number of objects from an archetype at once
+		// The storage and lists are grown once, the components are cloned into contiguous rows,
+		// and every component of the archetype is initialized for the whole batch before the next one
+		// Params:
+		//	name: The name of the archetype
+		//	count: The number of objects to create
+		//	function: Called on every object before it is initialized, can be empty
+		//	spawned: The list the new objects are added to, can be null
+		// Returns: The number of objects created, zero when no archetype has the name
+		size_t SpawnBatch(const std::string& name, size_t count, const SpawnFunction& function = SpawnFunction(), std::vector<GameObject*>* spawned = nullptr);
+		// Creates and adds a number of objects from an archetype at once
+		// Params:
+		//	name: The identifier of the archetype's name
+		//	count: The number of objects to create
+		//	function: Called on every object before it is initialized, can be empty
+		//	spawned: The list the new objects are added to, can be null
+		// Returns: The number of objects created, zero when no archetype has the name
+		size_t SpawnBatch(NameID name, size_t count, const SpawnFunction& function = SpawnFunction(), std::vector<GameObject*>* spawned = nullptr);
 		// Returns: All of the objects in the manager
 		const std::vector<GameObject*>& GetAllObjects() const;
+		// Sets how the components of objects created from archetypes are stored, only affects objects created afterwards
+		// Params:
+		//	mode: The storage mode
+		void SetStorageMode(StorageMode mode);
+		// Returns: How the components of objects created from archetypes are stored
+		StorageMode GetStorageMode() const;
+		// Sets how the objects are updated every frame
+		// Splitting the objects is only safe when the components do not create, destroy or change other objects while updating
+		// The phased update relies on every component type declaring what it reads and writes
+		// Params:
+		//	mode: The update mode
+		void SetUpdateMode(UpdateMode mode);
+		// Returns: How the objects are updated every frame
+		UpdateMode GetUpdateMode() const;
+		// Puts an object into the update lists or takes it out, called by the object when its components or sleep change
+		// Params:
+		//	object: The object
+		void RefreshUpdating(GameObject* object);
+		// Returns: The number of awake objects with components to update
+		size_t GetUpdatingCount() const;
+		// Sets the time between fixed updates
+		// Params:
+		//	dt: The fixed delta time, 1/30 or lower keeps the physics cheap under load while rendering stays smooth
+		//		Values that are not above zero are ignored
+		void SetFixedTimestep(double dt);
+		// Returns: The time between fixed updates
+		double GetFixedTimestep() const;
+		// Sets the most fixed updates run in a single frame, so a long frame cannot keep making the next one longer
+		// Params:
+		//	substeps: The number of fixed updates
+		void SetMaxSubsteps(unsigned substeps);
+		// Returns: The number of fixed updates run during the last frame
+		unsigned GetSubstepCount() const;
+		// Returns: The simulation time dropped during the last frame for going over the most fixed updates
+		double GetDroppedTime() const;
+		// Returns: How far the current frame is between the last fixed update and the next one, used to interpolate what is rendered
+		float GetInterpolationAlpha() const;
+		// Tells the queries that an object's components changed, called by the object when a component is added or removed
+		// Params:
+		//	object: The object
+		//	oldSignature: The object's signature before the change
+		void ChangeSignature(GameObject* object, unsigned long long oldSignature);
+		// Calls a function with the components of every object that has all of the component types
+		// The matching objects are cached per set of types, so only matching objects are visited
+		// Objects destroyed this frame are skipped, components added or removed from inside the function may be visited or skipped
+		// Params:
+		//	function: Called as function(Ts&... components) for every matching object
+		template <class... Ts, typename Function>
+		void Each(const Function& function);
 
 		// Gets the classes' singleton
 		// Returns: The classes' singleton
 		static GameObjectManager& GetInstance();
 	};
+
+	// Template Definitions
+
+	template <class... Ts, typename Function>
+	void GameObjectManager::Each(const Function& function)
+	{
+		// Build the signature of the types, types without a bit in the signature fall back to looking through every object
+		const ComponentTypeID types[] = { Ts::TypeID()... };
+		unsigned long long signature = 0;
+		bool indexed = true;
+		for (ComponentTypeID type : types)
+		{
+			if (type >= GameObject::maxIndexedTypes_)
+			{
+				indexed = false;
+				break;
+			}
+			signature |= 1ull << type;
+		}
+
+		if (!indexed)
+		{
+			for (size_t i = 0; i < gameObjects_.size(); ++i)
+			{
+				GameObject* object = gameObjects_[i];
+				bool matches = true;
+				for (ComponentTypeID type : types)
+				{
+					matches = matches && object->GetComponent(type) != nullptr;
+				}
+				if (matches && !object->IsDestroyed())
+				{
+					function(*object->GetComponent<Ts>()...);
+				}
+			}
+			return;
+		}
+
+		// Go by index, since the function may add or remove components and change the list
+		const std::vector<GameObject*>& objects = GetQuery(signature).objects_;
+		for (size_t i = 0; i < objects.size(); ++i)
+		{
+			GameObject* object = objects[i];
+			if (!object->IsDestroyed())
+			{
+				function(*object->GetComponent<Ts>()...);
+			}
+		}
+	}
 }
\ No newline at end of file
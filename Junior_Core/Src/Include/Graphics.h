@@ -5,7 +5,7 @@
  * File name: Graphics.h
  * Description: Declare the functionality of the window and the renderer under the same class
  * Created: 20 Apr 2018
- * Last Modified: 10 Sep 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes //
@@ -18,6 +18,7 @@
 #include "GameSystem.h"		// Game System
 #include "DrawProgram.h"	// The Drawing Programs
 #include "ResourceManager.h"// Resource Manager
+#include "RenderQueue.h"	// Render Queue
 
 #include "Event.h"			// Event
 
@@ -101,6 +102,8 @@ namespace Junior
 		GLFWwindow* windowHandle_;
 		// All of the shaders
 		std::vector<DrawProgram*> programs_;
+		// The draw commands of every mesh, built and sorted every frame
+		RenderQueue renderQueue_;
 		// Orthographic Matrix
 		Mat3 orthographicMatrix_;
 		
@@ -173,6 +176,8 @@ namespace Junior
 		int GetWindowHeight() const;
 		// Returns: The texture atlas
 		TextureAtlas* GetTextureAtlas();
+		// Returns: The render queue, which keeps the state change counts of the last frame
+		const RenderQueue& GetRenderQueue() const;
 		// Returns: The singleton instance of this class
 		static Graphics& GetInstance();
 	};
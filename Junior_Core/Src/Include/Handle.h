@@ -0,0 +1,210 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: Handle.h
+* Description: Generational handles to objects and components, which turn null once their target is deleted
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <vector>					// Vector
+#include <mutex>					// Mutex
+#include <atomic>					// Atomic
+#include <cstddef>					// Size T
+
+namespace Junior
+{
+	// Forward Declarations
+	class ComponentContainer;
+
+	// A 64 bit reference into the handle table, the generation tells apart the targets that used the same slot
+	struct HandleID
+	{
+		// The slot of the target inside the handle table
+		unsigned index_ = 0;
+		// The generation of the slot when the handle was made, zero for a null handle
+		unsigned generation_ = 0;
+
+		// Returns: Whether the handle was never given a target
+		bool IsNull() const
+		{
+			return generation_ == 0;
+		}
+	};
+
+	// Compares two handles
+	// Params:
+	//	lhs: The left handle
+	//	rhs: The right handle
+	// Returns: Whether both handles refer to the same slot and generation
+	inline bool operator==(const HandleID& lhs, const HandleID& rhs)
+	{
+		return lhs.index_ == rhs.index_ && lhs.generation_ == rhs.generation_;
+	}
+
+	// Compares two handles
+	// Params:
+	//	lhs: The left handle
+	//	rhs: The right handle
+	// Returns: Whether the handles refer to different slots or generations
+	inline bool operator!=(const HandleID& lhs, const HandleID& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	// Keeps the address of every object and component with a handle, in blocks of slots that never move
+	class HandleTable
+	{
+	private:
+		// Private Structures
+
+		// The target of a handle, read without the lock while the slot may be changed
+		struct Slot
+		{
+			// The address of the target, null when the slot is free
+			std::atomic<void*> target_;
+			// Increased every time the slot is released, so older handles stop resolving
+			std::atomic<unsigned> generation_;
+		};
+
+		// Private Constants
+
+		// The number of slots in every block
+		static const unsigned slotsPerBlock_ = 4096;
+		// The most blocks the table can hold, the block list is fixed so looking up a slot never races a reallocation
+		static const unsigned maxBlocks_ = 1024;
+
+		// Private Member Variables
+
+		// The blocks of slots
+		Slot* blocks_[maxBlocks_];
+		// The number of blocks allocated, increased only once the new block is filled in
+		std::atomic<unsigned> blockCount_;
+		// The released slots waiting to be reused
+		std::vector<unsigned> freeSlots_;
+		// The number of slots in use
+		size_t liveCount_;
+		// Locks registration and release, targets may be created from the job system's workers
+		std::mutex mutex_;
+
+		// Private Member Functions
+
+		// Default Constructor
+		HandleTable();
+		// Destructor releases the blocks
+		~HandleTable();
+	public:
+		// Public Member Functions
+
+		// Gives a slot to a target
+		// Params:
+		//	target: The address of the target
+		// Returns: The handle of the target
+		HandleID Register(void* target);
+		// Frees the slot of a target, every handle to it resolves to null from now on
+		// Params:
+		//	handle: The target's handle
+		void Release(HandleID handle);
+		// Finds the target of a handle, from any thread and without the lock
+		// Params:
+		//	handle: The handle
+		// Returns: The address of the target, or null when the handle is null or its target was released
+		void* Resolve(HandleID handle) const
+		{
+			if (handle.index_ >= blockCount_.load(std::memory_order_acquire) * slotsPerBlock_)
+			{
+				return nullptr;
+			}
+			const Slot& slot = blocks_[handle.index_ / slotsPerBlock_][handle.index_ % slotsPerBlock_];
+			// Releasing a slot changes the generation before the target, so a target read before a generation that
+			// still matches belongs to the handle, even when the slot is released and taken again in between
+			void* target = slot.target_.load(std::memory_order_acquire);
+			return slot.generation_.load(std::memory_order_acquire) == handle.generation_ ? target : nullptr;
+		}
+		// Returns: The number of slots in use
+		size_t GetLiveCount() const;
+
+		// Gets the classes' singleton
+		// Returns: The classes' singleton
+		static HandleTable& GetInstance();
+	};
+
+	// Turns a handle table target back into its type, components are registered through their container
+	// Params:
+	//	target: The address stored in the handle table
+	// Returns: The target
+	template <class T>
+	T* CastHandleTarget(void* target, const ComponentContainer*)
+	{
+		return static_cast<T*>(static_cast<ComponentContainer*>(target));
+	}
+
+	// Turns a handle table target back into its type
+	// Params:
+	//	target: The address stored in the handle table
+	// Returns: The target
+	template <class T>
+	T* CastHandleTarget(void* target, const void*)
+	{
+		return static_cast<T*>(target);
+	}
+
+	// A typed handle, which can be stored in place of a raw pointer and resolves to null once its target is deleted
+	template <class T>
+	class Handle
+	{
+	private:
+		// Private Member Variables
+
+		// The handle inside the table
+		HandleID id_;
+	public:
+		// Public Member Functions
+
+		// Default Constructor makes a null handle
+		Handle()
+			: id_()
+		{
+		}
+
+		// Constructor
+		// Params:
+		//	target: The target to refer to, can be null
+		Handle(const T* target)
+			: id_()
+		{
+			if (target)
+			{
+				id_ = target->GetHandle();
+			}
+		}
+
+		// Returns: The target, or null when it was deleted
+		T* Get() const
+		{
+			static_assert(sizeof(T) > 0, "The target type must be complete to resolve a handle");
+			void* target = HandleTable::GetInstance().Resolve(id_);
+			return target ? CastHandleTarget<T>(target, static_cast<T*>(nullptr)) : nullptr;
+		}
+
+		// Returns: The target, which must still be alive
+		T* operator->() const
+		{
+			return Get();
+		}
+
+		// Returns: Whether the target is still alive
+		explicit operator bool() const
+		{
+			return Get() != nullptr;
+		}
+
+		// Returns: The handle inside the table
+		HandleID GetID() const
+		{
+			return id_;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: InstanceRingBuffer.h
+* Description: A vertex buffer split into three regions that are written by the CPU while the GPU reads the others, guarded by fences
+* Created: 17-Oct-2026
+* Last Modified: 17-Oct-2026
+*/
+
+// Includes //
+#include <cstddef>				// Size T
+#include "OpenGLBundle.h"		// OpenGL
+
+namespace Junior
+{
+	class InstanceRingBuffer
+	{
+	public:
+		// Public Static Constants //
+
+		// The number of regions, so the CPU writes one while the GPU can still be reading the two before it
+		const static unsigned NUM_REGIONS = 3;
+	private:
+		// Private Static Variables //
+
+		// Whether buffers use persistent mapping when the driver supports it
+		static bool allowPersistentMapping_;
+
+		// Private Member Variables //
+
+		// The buffer object
+		GLuint bufferObject_;
+		// The size of a single region in bytes
+		size_t regionSize_;
+		// Whether the buffer stays mapped for its whole life (glBufferStorage), or every range is uploaded with glBufferSubData
+		bool persistent_;
+		// The start of the persistently mapped buffer, null when the ranges are uploaded with glBufferSubData
+		unsigned char* mapped_;
+		// The region being written, or the next one to be written
+		unsigned currentRegion_;
+		// The fences placed after the GPU was told to read every region, null when the region is free
+		GLsync fences_[NUM_REGIONS];
+		// The number of bytes written during the last write
+		size_t bytesUploaded_;
+		// The number of times the last write had to wait for the GPU to let go of its region
+		unsigned fenceStalls_;
+
+		// Private Member Functions //
+
+		// Creates the buffer object for the current region size
+		void CreateBuffer();
+		// Waits for every region to be free and deletes the buffer object
+		void DestroyBuffer();
+		// Waits until the GPU finished reading a region
+		// Params:
+		//	region: The region
+		// Returns: Whether the CPU had to wait
+		bool WaitForRegion(unsigned region);
+		// Hidden Copy Constructor and Assignment Operator, the buffer object, fences and mapping belong to a single ring buffer
+		InstanceRingBuffer(const InstanceRingBuffer& other) = delete;
+		InstanceRingBuffer& operator=(const InstanceRingBuffer& other) = delete;
+	public:
+		// Public Member Functions //
+
+		// Constructor, needs a current OpenGL context
+		// Params:
+		//	regionSize: The starting size of a region in bytes, grows when a write needs more
+		InstanceRingBuffer(size_t regionSize);
+		// Destructor
+		~InstanceRingBuffer();
+		// Starts writing into the next region, waiting for the GPU to finish reading it first
+		// The region keeps what was written into it three writes ago, so only what changed since then has to be written again
+		// Params:
+		//	size: The number of bytes the region has to hold
+		// Returns: Whether the buffer had to grow, which loses what every region held
+		bool BeginWrite(size_t size);
+		// Writes a range of bytes into the region being written
+		// Params:
+		//	offset: Where the range starts, in bytes from the start of the region
+		//	data: The bytes
+		//	size: The number of bytes
+		void WriteRange(size_t offset, const void* data, size_t size);
+		// Ends writing into the region
+		// Returns: The offset of the region inside of the buffer, for the vertex attributes to point at
+		size_t EndWrite();
+		// Returns: The region being written, or the next one to be written
+		unsigned GetCurrentRegion() const;
+		// Places the fence for the written region after the draw calls reading it, and moves on to the next region
+		void Fence();
+		// Returns: The buffer object
+		GLuint GetBufferObject() const;
+		// Returns: Whether the buffer is persistently mapped
+		bool IsPersistent() const;
+		// Returns: The number of bytes written during the last write
+		size_t GetBytesUploaded() const;
+		// Returns: The number of times the last write had to wait for the GPU
+		unsigned GetFenceStallCount() const;
+
+		// Public Static Functions //
+
+		// Sets whether new buffers use persistent mapping when the driver supports it, turn it off to test the fallback
+		// Params:
+		//	allow: Whether persistent mapping is allowed
+		static void AllowPersistentMapping(bool allow);
+	};
+}
\ No newline at end of file
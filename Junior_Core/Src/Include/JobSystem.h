@@ -0,0 +1,212 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: JobSystem.h
+* Description: Runs small jobs on a fixed pool of worker threads, each worker steals from the others when it runs out of work
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <vector>					// Vector
+#include <deque>					// Double Ended Queue
+#include <thread>					// Thread
+#include <mutex>					// Mutex
+#include <condition_variable>		// Condition Variable
+#include <atomic>					// Atomic
+#include <functional>				// Function
+#include <cstddef>					// Size T
+#include "GameSystem.h"				// Game System
+
+namespace Junior
+{
+	// Forward Declarations
+	class JobCounter;
+
+	// Type Definitions
+
+	// The work a job does
+	typedef std::function<void()> JobFunction;
+
+	// A unit of work waiting to be run
+	struct Job
+	{
+		// The work to do
+		JobFunction function_;
+		// The counter that is told when the job finishes, can be null
+		JobCounter* counter_;
+	};
+
+	// Counts the jobs that have not finished yet, jobs can wait on a counter before they are queued
+	class JobCounter
+	{
+	private:
+		// Friend Classes
+		friend class JobSystem;
+
+		// Private Member Variables
+
+		// The number of jobs that have not finished yet
+		std::atomic<unsigned> pending_;
+		// Locks the waiting jobs and the moment the counter reaches zero
+		std::mutex mutex_;
+		// The jobs queued once the counter reaches zero
+		std::vector<Job> waiting_;
+
+	public:
+		// Public Member Functions
+
+		// Constructor
+		JobCounter();
+		// Returns: Whether every job counted has finished
+		bool IsDone() const;
+		// Returns: The number of jobs that have not finished yet
+		unsigned GetPending() const;
+	};
+
+	class JobSystem : public GameSystem
+	{
+	private:
+		// Private Structures
+
+		// The jobs of a single worker, the worker takes from the back and the others steal from the front
+		struct WorkQueue
+		{
+			// Locks the jobs
+			std::mutex mutex_;
+			// The jobs
+			std::deque<Job> jobs_;
+		};
+
+		// Private Member Variables
+
+		// The worker threads, the main thread works on the first queue while it waits
+		std::vector<std::thread> workers_;
+		// One queue for the main thread and one for every worker
+		std::vector<WorkQueue*> queues_;
+		// The number of jobs sitting in every queue
+		std::atomic<unsigned> queuedJobs_;
+		// Whether the workers should stop
+		std::atomic<bool> quitting_;
+		// Locks the sleeping workers
+		std::mutex sleepMutex_;
+		// Wakes up the sleeping workers when jobs come in
+		std::condition_variable wakeUp_;
+		// The number of threads the system was asked to use, zero uses one less than the number of cores
+		unsigned requestedWorkers_;
+
+		// Private Member Functions
+
+		// Default Constructor
+		JobSystem();
+		// The loop every worker thread runs until the system shuts down
+		// Params:
+		//	queue: The index of the worker's queue
+		void WorkerLoop(unsigned queue);
+		// Finds a job, first from the calling thread's queue and then from the others
+		// Params:
+		//	job: The job found
+		// Returns: Whether a job was found
+		bool FindJob(Job& job);
+		// Puts a job into the calling thread's queue and wakes up a worker
+		// Params:
+		//	job: The job to queue
+		void Queue(Job& job);
+		// Runs a job and tells its counter
+		// Params:
+		//	job: The job to run
+		void Execute(Job& job);
+		// Marks a job of a counter as finished, queueing the jobs waiting on it when it reaches zero
+		// Params:
+		//	counter: The counter
+		void Finish(JobCounter& counter);
+	public:
+		// Public Member Functions
+
+		// Starts the worker threads
+		// Returns: Whether the system succeded in loading
+		bool Load() override;
+		// Initializes the system
+		// Returns: Whether the system succeded in initializing
+		bool Initialize() override;
+		// Updates the system
+		// Params:
+		//	dt: The time between frames
+		void Update(double dt) override;
+		// Renders the system
+		void Render() override;
+		// Runs every job left
+		void Shutdown() override;
+		// Stops and joins the worker threads
+		void Unload() override;
+
+		// Queues a job
+		// Params:
+		//	function: The work to do
+		//	counter: The counter that is told when the job finishes, can be null
+		void Run(const JobFunction& function, JobCounter* counter = nullptr);
+		// Queues a job once every job of another counter finishes
+		// Params:
+		//	dependency: The counter to wait on
+		//	function: The work to do
+		//	counter: The counter that is told when the job finishes, can be null
+		void RunAfter(JobCounter& dependency, const JobFunction& function, JobCounter* counter = nullptr);
+		// Runs jobs on the calling thread until every job of the counter finishes
+		// Params:
+		//	counter: The counter to wait on
+		void Wait(JobCounter& counter);
+		// Splits a range into batches and runs them on the workers, returns once they are all finished
+		// Params:
+		//	begin: The first index
+		//	end: One past the last index
+		//	batchSize: The number of indices in each batch, zero splits the range evenly between the threads
+		//	function: Called as function(batchBegin, batchEnd) for every batch
+		template <typename Function>
+		void ParallelFor(size_t begin, size_t end, size_t batchSize, const Function& function);
+		// Sets the number of worker threads, only takes effect when the system is loaded
+		// Params:
+		//	count: The number of workers, zero uses one less than the number of cores
+		void SetWorkerCount(unsigned count);
+		// Returns: The number of threads running jobs, counting the main thread
+		unsigned GetThreadCount() const;
+
+		// Gets the classes' singleton
+		// Returns: The classes' singleton
+		static JobSystem& GetInstance();
+	};
+
+	// Template Definitions
+
+	template <typename Function>
+	void JobSystem::ParallelFor(size_t begin, size_t end, size_t batchSize, const Function& function)
+	{
+		if (end <= begin)
+		{
+			return;
+		}
+
+		// A few batches per thread, so the threads that finish early can steal the rest
+		size_t count = end - begin;
+		if (batchSize == 0)
+		{
+			size_t batches = GetThreadCount() * 4;
+			batchSize = (count + batches - 1) / batches;
+		}
+		if (workers_.empty() || count <= batchSize)
+		{
+			function(begin, end);
+			return;
+		}
+
+		// The first batch is kept for the calling thread
+		JobCounter counter;
+		for (size_t batchBegin = begin + batchSize; batchBegin < end; batchBegin += batchSize)
+		{
+			size_t batchEnd = count - (batchBegin - begin) < batchSize ? end : batchBegin + batchSize;
+			Run([&function, batchBegin, batchEnd]() { function(batchBegin, batchEnd); }, &counter);
+		}
+		function(begin, begin + batchSize);
+		Wait(counter);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: LevelStreamer.h
+* Description: Loads and unloads the cells of a level around the main camera, reading their files on the job system's workers
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <vector>				// Vector
+#include <string>				// String
+#include <memory>				// Shared Pointer
+#include <atomic>				// Atomic
+#include <unordered_map>		// Unordered Map
+#include <cstddef>				// Size T
+#include "Handle.h"				// Handle
+
+namespace Junior
+{
+	// Forward Declarations
+	class GameObject;
+	class Transform;
+	class Parser;
+
+	// A cell of a level, as it is listed in the level's cell index
+	struct LevelCell
+	{
+		// The cell's column
+		int x_;
+		// The cell's row
+		int y_;
+		// The number of objects inside of the cell
+		unsigned numObjects_;
+	};
+
+	class LevelStreamer
+	{
+	private:
+		// Private Structures
+
+		// The states a cell goes through while it is streamed in
+		enum CellState
+		{
+			CELL_UNLOADED,
+			CELL_READING,
+			CELL_LOADING,
+			CELL_LOADED
+		};
+
+		// The contents of a cell's file, filled in by a worker thread
+		struct FileRead
+		{
+			// The text of the file
+			std::string contents_;
+			// Whether the file could not be read
+			bool failed_;
+			// Whether the worker finished, the rest of the structure belongs to the worker until then
+			std::atomic<bool> done_;
+		};
+
+		// A cell and everything streamed in for it
+		struct Cell
+		{
+			// The cell as it is listed in the index
+			LevelCell info_;
+			// How far along the cell is
+			CellState state_;
+			// The file being read, shared with the worker so a cell can be unloaded before the read finishes
+			std::shared_ptr<FileRead> read_;
+			// Reads the objects out of the file's contents, a few of them every frame
+			Parser* parser_;
+			// The number of objects left to read
+			unsigned remaining_;
+			// The objects created for the cell, some of them could have been destroyed since
+			std::vector<Handle<GameObject>> objects_;
+		};
+
+		// Private Member Variables
+
+		// The name of the level being streamed
+		std::string levelName_;
+		// The size of a cell in world units
+		float cellSize_;
+		// Every cell of the level
+		std::unordered_map<long long, Cell> cells_;
+		// The cells that are not unloaded, in no particular order
+		std::vector<long long> active_;
+		// The number of cells around the camera's cell that are loaded
+		int loadRadius_;
+		// The number of cells past the load radius a cell has to be before it is unloaded, so cells on the edge do not keep reloading
+		int hysteresis_;
+		// The number of streamed objects allowed at once
+		size_t objectBudget_;
+		// The number of objects of every active cell
+		size_t residentObjects_;
+		// The number of objects created every frame, spreading big cells over a few frames
+		unsigned objectsPerFrame_;
+
+		// Private Member Functions
+
+		// Default Constructor
+		LevelStreamer();
+		// Finds the key of a cell
+		// Params:
+		//	x: The cell's column
+		//	y: The cell's row
+		// Returns: The key of the cell
+		static long long MakeKey(int x, int y);
+		// Finds how far a cell is from another one, counting diagonal cells as one step
+		// Params:
+		//	cell: The cell
+		//	x: The other cell's column
+		//	y: The other cell's row
+		// Returns: The distance in cells
+		static int Distance(const Cell& cell, int x, int y);
+		// Returns: The transform the cells are loaded around, the main camera's transform, or null when there is no camera
+		static Transform* FindFocus();
+		// Starts reading a cell's file on a worker thread
+		// Params:
+		//	cell: The cell
+		void StartReading(Cell& cell);
+		// Reads the header of a cell whose file was read
+		// Params:
+		//	cell: The cell
+		void StartLoading(Cell& cell);
+		// Creates the objects of a cell that is loading
+		// Params:
+		//	cell: The cell
+		//	budget: The number of objects that can still be created this frame, lowered by the number created
+		void LoadObjects(Cell& cell, unsigned& budget);
+		// Unloads a cell, destroying every object created for it
+		// Params:
+		//	cell: The cell
+		void Release(Cell& cell);
+		// Unloads the farthest active cell outside of the load radius
+		// Params:
+		//	x: The column of the camera's cell
+		//	y: The row of the camera's cell
+		// Returns: Whether a cell was unloaded
+		bool EvictFarthest(int x, int y);
+	public:
+		// Public Member Functions
+
+		// Destructor
+		~LevelStreamer();
+		// Starts streaming the cells of a level, any level streamed before is closed
+		// Params:
+		//	levelName: The name of the level
+		//	cellSize: The size of a cell in world units
+		//	cells: The cells of the level
+		void Open(const std::string& levelName, float cellSize, const std::vector<LevelCell>& cells);
+		// Stops streaming, unloading every cell
+		void Close();
+		// Loads the cells that came near the camera and unloads the ones that went far from it
+		void Update();
+		// Sets the number of cells around the camera's cell that are loaded
+		// Params:
+		//	radius: The number of cells
+		void SetLoadRadius(int radius);
+		// Sets the number of cells past the load radius a cell has to be before it is unloaded
+		// Params:
+		//	hysteresis: The number of cells
+		void SetHysteresis(int hysteresis);
+		// Sets the number of streamed objects allowed at once, cells that do not fit wait until farther cells are unloaded
+		// Params:
+		//	budget: The number of objects
+		void SetObjectBudget(size_t budget);
+		// Sets the number of objects created every frame
+		// Params:
+		//	count: The number of objects
+		void SetObjectsPerFrame(unsigned count);
+		// Returns: The number of objects of every cell that is loaded or on its way
+		size_t GetResidentObjectCount() const;
+		// Returns: The number of cells that are loaded or on their way
+		size_t GetActiveCellCount() const;
+
+		// Gets the classes' singleton
+		// Returns: The classes' singleton
+		static LevelStreamer& GetInstance();
+	};
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 * Author: David Wong
 * Email: david.wongcascante@digipen.edu
 * Created: 24-Apr-2018
-* Last Modified: 29-Oct-2018
+* Last Modified: 17-Oct-2026
 * Description: Declare the extra vector and matrix math
 * File Name: LinearMath.h
 */
@@ -10,6 +10,7 @@
 // Includes
 //#include "Vec3.h"
 //#include "Mat3.h"
+#include <cstddef>			// Size T
 
 // DEFINES
 // Define the conversion between Radians and Degrees
@@ -22,6 +23,7 @@ namespace Junior
 	// Forward Declarations
 	union Vec3;
 	union Mat3;
+	union Affine2D;
 
 	// Global Functions
 	// Gives the dot product between two vectors
@@ -91,6 +93,23 @@ namespace Junior
 	//	angle: The angle we want to rotate by
 	// Returns: The rotation matrix around the Z axis by the provided angle
 	Mat3 Rotation(float angle);
+	// Builds many Translation * Rotation * Scale matrices at once, writing the 2D affine result directly
+	// The sine and cosine of every rotation are computed once, four objects at a time when SIMD is available
+	// Params:
+	//	translations: The translation of every object
+	//	rotations: The rotation around the Z axis of every object, accurate for angles up to a few thousand radians
+	//	scalings: The scaling of every object
+	//	out: The matrices we are writing to
+	//	count: The number of objects
+	void ComposeTransformations(const Vec3* translations, const float* rotations, const Vec3* scalings, Mat3* out, size_t count);
+	// Builds many Translation * Rotation * Scale transformations on the xy plane at once, the z components are ignored
+	// Params:
+	//	translations: The translation of every object
+	//	rotations: The rotation around the Z axis of every object, accurate for angles up to a few thousand radians
+	//	scalings: The scaling of every object
+	//	out: The affine transformations we are writing to
+	//	count: The number of objects
+	void ComposeTransformations(const Vec3* translations, const float* rotations, const Vec3* scalings, Affine2D* out, size_t count);
 	// Transposes the matrix
 	// Params:
 	//	mat: The matrix we want to transpose
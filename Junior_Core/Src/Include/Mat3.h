@@ -5,15 +5,16 @@
 * File name: Mat3.h
 * Description: Tell the compiler what a 3x3 matrix can do before actually telling them how (column major order)
 * Created: 26-Apr-2018
-* Last Modified: 29-Oct-2018
+* Last Modified: 17-Oct-2026
 */
 
 #include <iostream>			// IO stream
 #include <fstream>			// File Stream
+#include "Vec3.h"			// Vec3
+#include "MathSimd.h"		// SIMD Switches
 
 namespace Junior
 {
-	union Vec3;
 	union Mat3
 	{
 		// Public Union Variables //
@@ -31,49 +32,49 @@ namespace Junior
 	//	lhs: The left matrix
 	//	rhs: The right matrix
 	// Returns: Returns the added matrix
-	Mat3 operator+(const Mat3& lhs, const Mat3& rhs);
+	inline Mat3 operator+(const Mat3& lhs, const Mat3& rhs);
 	// Rests two matrices together
 	// Params:
 	//	lhs: The left matrix
 	//	rhs: The right matrix
 	// Returns: The left subtracted from the right
-	Mat3 operator-(const Mat3& lhs, const Mat3& rhs);
+	inline Mat3 operator-(const Mat3& lhs, const Mat3& rhs);
 	// Multiplies two matrices together
 	// Params:
 	//	lhs: The left matrix
 	//	rhs: The right matrix
 	// Returns: The multiplied the two matrices
-	Mat3 operator*(const Mat3& lhs, const Mat3& rhs);
+	inline Mat3 operator*(const Mat3& lhs, const Mat3& rhs);
 	// Multiplies the matrix and a float
 	// Params:
 	//	lhs: The left scalar
 	//	rhs: The right vector
 	// Returns: The scaled matrix
-	Mat3 operator*(float lhs, const Mat3& rhs);
+	inline Mat3 operator*(float lhs, const Mat3& rhs);
 	// Multiplies a matrix and a vector
 	// Params:
 	//	lhs: The left matrix
 	//	rhs: The right vector
 	// Returns: The transformed vector
-	Vec3 operator*(const Mat3& lhs, const Vec3& rhs);
+	inline Vec3 operator*(const Mat3& lhs, const Vec3& rhs);
 	// Adds a matrix into another
 	// Params:
 	//	lhs: The left matrix
 	//	rhs: The right matrix
 	// Returns: The left matrix post addition
-	Mat3& operator+=(Mat3& lhs, const Mat3& rhs);
+	inline Mat3& operator+=(Mat3& lhs, const Mat3& rhs);
 	// Subtracts one matrix from another
 	// Params:
 	//	lhs: The left matrix
 	//	rhs: The right matrix
 	// Returns: The left matrix post subtraction
-	Mat3& operator-=(Mat3& lhs, const Mat3& rhs);
+	inline Mat3& operator-=(Mat3& lhs, const Mat3& rhs);
 	// Multiplies a matrix by another
 	// Params:
 	//	lhs: The left matrix
 	//	rhs: The right matrix
 	// Returns: The left matrix post addition
-	Mat3& operator*=(Mat3& lhs, const Mat3& rhs);
+	inline Mat3& operator*=(Mat3& lhs, const Mat3& rhs);
 	// Prints a matrix into a output stream
 	// Params:
 	//	stream: The stream we are printing to
@@ -88,7 +89,149 @@ namespace Junior
 	std::fstream& operator<<(std::fstream& stream, const Mat3& matrix);
 	// Reads a matrix from a file stream
 	// Params:
-	//	stream: The file stream we are reading from
+	//	stream: The stream we are reading from, either a file or text that was already read
 	//	matrix: The matrix we are saving to
-	void operator>>(std::fstream& stream, Mat3& matrix);
-}
+	void operator>>(std::istream& stream, Mat3& matrix);
+
+	// Inline Definitions //
+
+	inline Mat3 operator+(const Mat3& lhs, const Mat3& rhs)
+	{
+		Mat3 out;
+#ifdef JUNIOR_MATH_SSE
+		for (unsigned i = 0; i < 16; i += 4)
+		{
+			_mm_storeu_ps(out.m_ + i, _mm_add_ps(_mm_loadu_ps(lhs.m_ + i), _mm_loadu_ps(rhs.m_ + i)));
+		}
+#else
+		for (unsigned i = 0; i < 16; ++i)
+		{
+			out.m_[i] = lhs.m_[i] + rhs.m_[i];
+		}
+#endif
+		return out;
+	}
+
+	inline Mat3 operator-(const Mat3& lhs, const Mat3& rhs)
+	{
+		Mat3 out;
+#ifdef JUNIOR_MATH_SSE
+		for (unsigned i = 0; i < 16; i += 4)
+		{
+			_mm_storeu_ps(out.m_ + i, _mm_sub_ps(_mm_loadu_ps(lhs.m_ + i), _mm_loadu_ps(rhs.m_ + i)));
+		}
+#else
+		for (unsigned i = 0; i < 16; ++i)
+		{
+			out.m_[i] = lhs.m_[i] - rhs.m_[i];
+		}
+#endif
+		return out;
+	}
+
+	inline Mat3 operator*(const Mat3& lhs, const Mat3& rhs)
+	{
+		Mat3 out;
+		// Every column of the result is the left matrix's columns weighted by the right matrix's column
+#if defined(JUNIOR_MATH_AVX)
+		// Two columns of the result at a time, the left columns are repeated in both halves of the registers
+		// The columns are loaded unaligned first, since the matrix only has the alignment of a float
+		__m128 left0 = _mm_loadu_ps(lhs.m_ + 0);
+		__m128 left1 = _mm_loadu_ps(lhs.m_ + 4);
+		__m128 left2 = _mm_loadu_ps(lhs.m_ + 8);
+		__m128 left3 = _mm_loadu_ps(lhs.m_ + 12);
+		__m256 column0 = _mm256_insertf128_ps(_mm256_castps128_ps256(left0), left0, 1);
+		__m256 column1 = _mm256_insertf128_ps(_mm256_castps128_ps256(left1), left1, 1);
+		__m256 column2 = _mm256_insertf128_ps(_mm256_castps128_ps256(left2), left2, 1);
+		__m256 column3 = _mm256_insertf128_ps(_mm256_castps128_ps256(left3), left3, 1);
+		for (unsigned i = 0; i < 16; i += 8)
+		{
+			__m256 right = _mm256_loadu_ps(rhs.m_ + i);
+			__m256 result = _mm256_mul_ps(column0, _mm256_shuffle_ps(right, right, 0x00));
+			result = _mm256_add_ps(result, _mm256_mul_ps(column1, _mm256_shuffle_ps(right, right, 0x55)));
+			result = _mm256_add_ps(result, _mm256_mul_ps(column2, _mm256_shuffle_ps(right, right, 0xAA)));
+			result = _mm256_add_ps(result, _mm256_mul_ps(column3, _mm256_shuffle_ps(right, right, 0xFF)));
+			_mm256_storeu_ps(out.m_ + i, result);
+		}
+#elif defined(JUNIOR_MATH_SSE)
+		__m128 column0 = _mm_loadu_ps(lhs.m_ + 0);
+		__m128 column1 = _mm_loadu_ps(lhs.m_ + 4);
+		__m128 column2 = _mm_loadu_ps(lhs.m_ + 8);
+		__m128 column3 = _mm_loadu_ps(lhs.m_ + 12);
+		for (unsigned i = 0; i < 16; i += 4)
+		{
+			__m128 right = _mm_loadu_ps(rhs.m_ + i);
+			__m128 result = _mm_mul_ps(column0, _mm_shuffle_ps(right, right, 0x00));
+			result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_shuffle_ps(right, right, 0x55)));
+			result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_shuffle_ps(right, right, 0xAA)));
+			result = _mm_add_ps(result, _mm_mul_ps(column3, _mm_shuffle_ps(right, right, 0xFF)));
+			_mm_storeu_ps(out.m_ + i, result);
+		}
+#else
+		for (unsigned i = 0; i < 4; ++i)
+		{
+			for (unsigned j = 0; j < 4; ++j)
+			{
+				out.m_[i * 4 + j] = rhs.m_[4 * i + 0] * lhs.m_[4 * 0 + j] + rhs.m_[4 * i + 1] * lhs.m_[4 * 1 + j]
+					+ rhs.m_[4 * i + 2] * lhs.m_[4 * 2 + j] + rhs.m_[4 * i + 3] * lhs.m_[4 * 3 + j];
+			}
+		}
+#endif
+		return out;
+	}
+
+	inline Mat3 operator*(float scalar, const Mat3& rhs)
+	{
+		Mat3 out;
+#ifdef JUNIOR_MATH_SSE
+		__m128 scale = _mm_set1_ps(scalar);
+		for (unsigned i = 0; i < 16; i += 4)
+		{
+			_mm_storeu_ps(out.m_ + i, _mm_mul_ps(_mm_loadu_ps(rhs.m_ + i), scale));
+		}
+#else
+		for (unsigned i = 0; i < 16; ++i)
+		{
+			out.m_[i] = rhs.m_[i] * scalar;
+		}
+#endif
+		return out;
+	}
+
+	inline Vec3 operator*(const Mat3& lhs, const Vec3& rhs)
+	{
+		Vec3 out;
+#ifdef JUNIOR_MATH_SSE
+		__m128 right = Simd::Load(rhs);
+		__m128 result = _mm_mul_ps(_mm_loadu_ps(lhs.m_ + 0), _mm_shuffle_ps(right, right, 0x00));
+		result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(lhs.m_ + 4), _mm_shuffle_ps(right, right, 0x55)));
+		result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(lhs.m_ + 8), _mm_shuffle_ps(right, right, 0xAA)));
+		result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(lhs.m_ + 12), _mm_shuffle_ps(right, right, 0xFF)));
+		Simd::Store(out, result);
+#else
+		out.x_ = (lhs.m00_ * rhs.x_) + (lhs.m01_ * rhs.y_) + (lhs.m02_ * rhs.z_) + (lhs.m03_ * rhs.w_);
+		out.y_ = (lhs.m10_ * rhs.x_) + (lhs.m11_ * rhs.y_) + (lhs.m12_ * rhs.z_) + (lhs.m13_ * rhs.w_);
+		out.z_ = (lhs.m20_ * rhs.x_) + (lhs.m21_ * rhs.y_) + (lhs.m22_ * rhs.z_) + (lhs.m23_ * rhs.w_);
+		out.w_ = (lhs.m30_ * rhs.x_) + (lhs.m31_ * rhs.y_) + (lhs.m32_ * rhs.z_) + (lhs.m33_ * rhs.w_);
+#endif
+		return out;
+	}
+
+	inline Mat3& operator+=(Mat3& lhs, const Mat3& rhs)
+	{
+		lhs = lhs + rhs;
+		return lhs;
+	}
+
+	inline Mat3& operator-=(Mat3& lhs, const Mat3& rhs)
+	{
+		lhs = lhs - rhs;
+		return lhs;
+	}
+
+	inline Mat3& operator*=(Mat3& lhs, const Mat3& rhs)
+	{
+		lhs = lhs * rhs;
+		return lhs;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: MathSimd.h
+* Description: Chooses which instruction set the inline Vec3 and Mat3 math is written with
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Defines
+// The math uses SSE2 whenever the target supports it, and AVX for matrix products when the compiler targets AVX (/arch:AVX)
+// Define JUNIOR_MATH_SCALAR in the project's preprocessor definitions to go back to the plain C++ math
+// The switch has to be the same for every file, since the math functions are inline
+#if !defined(JUNIOR_MATH_SCALAR) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#define JUNIOR_MATH_SSE
+#include <emmintrin.h>				// SSE2
+#if defined(__AVX__)
+#define JUNIOR_MATH_AVX
+#include <immintrin.h>				// AVX
+#endif
+#endif
\ No newline at end of file
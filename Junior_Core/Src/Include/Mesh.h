@@ -6,7 +6,7 @@
  * Description: Meshes hold the data to render generic data to render sprites into the screen
 				as well as custom data
  * Created: 1 May 2019
- * Last Modified: 2 May 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -16,6 +16,10 @@
 
 namespace Junior
 {
+	// Forward Declarations
+	class RenderQueue;
+	struct RenderCommand;
+
 	struct BasicData
 	{
 		// Public Static Variables
@@ -63,6 +67,8 @@ namespace Junior
 		std::string name_;
 		// Basic mesh data
 		BasicData basicData_;
+		// The layer the mesh's draw commands are put in, lower layers are drawn first
+		unsigned layer_;
 
 		// Private Member Functions
 
@@ -103,6 +109,12 @@ namespace Junior
 		void StartBinding();
 		// Ends binding the mesh
 		inline void EndBinding();
+		// Sets the layer the mesh's draw commands are put in
+		// Params:
+		//	layer: The layer, lower layers are drawn first
+		void SetLayer(unsigned layer);
+		// Returns: The layer the mesh's draw commands are put in
+		unsigned GetLayer() const;
 
 		// Virtual Functions
 
@@ -112,6 +124,20 @@ namespace Junior
 		// Params:
 		//	shaderID: The shader's id
 		virtual void Draw(unsigned shaderID);
+		// Adds the mesh's draw commands to the render queue, the whole mesh is a single command by default
+		// Params:
+		//	queue: The render queue
+		virtual void Submit(RenderQueue& queue);
+		// Binds the texture of a draw command, only called when the texture differs from the last command's
+		// Params:
+		//	command: The draw command
+		//	shaderID: The shader's id
+		virtual void BindTexture(const RenderCommand& command, unsigned shaderID);
+		// Draws one of the mesh's draw commands, the whole mesh by default
+		// Params:
+		//	command: The draw command
+		//	shaderID: The shader's id
+		virtual void DrawCommand(const RenderCommand& command, unsigned shaderID);
 
 	protected:
 		// Protected Member Functions
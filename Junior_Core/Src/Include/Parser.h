@@ -5,11 +5,12 @@
 * File name: Parser.h
 * Description: Parses through a text file
 * Created: 27-Mar-2019
-* Last Modified: 8-Apr-2019
+* Last Modified: 17-Oct-2026
 */
 
 // Includes
 #include <fstream>				// File Streams
+#include <sstream>				// String Streams
 #include <exception>			// Exception
 #include <string>				// String
 #include "Resource.h"			// Resource
@@ -28,6 +29,10 @@ namespace Junior
 		// Private Member Variables
 		// The file we are reading from
 		std::fstream file_;
+		// The text we are reading from, when the parser was given the contents of a file that was already read
+		std::stringstream memory_;
+		// The stream every read and write goes through, either the file or the text
+		std::iostream* stream_;
 		// The file name
 		std::string fileName_;
 		// How many tabs we accumulated
@@ -45,6 +50,11 @@ namespace Junior
 		//	fileName: The file name we are parsing through
 		//	mode: The mode we are parsing file
 		Parser(const std::string& fileName, std::fstream::openmode mode = std::ios::in);
+		// Constructor that reads from text already in memory, so files can be read on another thread and parsed later
+		// Params:
+		//	fileName: The name of the file the text came from, used in errors
+		//	contents: The contents of the file
+		Parser(const std::string& fileName, const std::string& contents);
 		// Copy Constructor
 		// Params:
 		//	other: The other parser we are trying to copy from
@@ -70,7 +80,7 @@ namespace Junior
 		{
 			CheckIfOpen();
 			std::string word;
-			file_ >> word;
+			*stream_ >> word;
 			// Test if the names are the same first
 			if (word != varName)
 			{
@@ -78,7 +88,7 @@ namespace Junior
 			}
 			// then read the name of the variables
 			Skip(":");
-			file_ >> value;
+			*stream_ >> value;
 		}
 		// Writes a variable to the file
 		// Params:
@@ -92,10 +102,10 @@ namespace Junior
 			// Fill in the tabs
 			for (unsigned i = 0; i < numTabs_; ++i)
 			{
-				file_ << tab_;
+				*stream_ << tab_;
 			}
 			// Write the variable
-			file_ << varName << " : " << value << std::endl;
+			*stream_ << varName << " : " << value << std::endl;
 		}
 		// Reads through a value
 		// Params:
@@ -105,7 +115,7 @@ namespace Junior
 		void ReadValue(T& value)
 		{
 			CheckIfOpen();
-			file_ >> value;
+			*stream_ >> value;
 		}
 		// Writes a variable to the file
 		// Params:
@@ -118,10 +128,10 @@ namespace Junior
 			// Fill in the amount of tabs we got
 			for (unsigned i = 0; i < numTabs_; ++i)
 			{
-				file_ << tab_;
+				*stream_ << tab_;
 			}
 			// Write the value
-			file_ << value << std::endl;
+			*stream_ << value << std::endl;
 		};
 		// Opens a file
 		// Params:
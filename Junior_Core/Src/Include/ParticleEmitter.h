@@ -5,7 +5,7 @@
 * File name: ParticleEmitter.h
 * Description: Emits the particles
 * Created: 6 May 2018
-* Last Modified: 6 May 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -13,6 +13,7 @@
 #include "Component.h"				// Component
 #include "Particle.h"				// Particle
 #include "Random.h"					// Random
+#include "SharedData.h"				// Shared Data
 
 namespace Junior
 {
@@ -49,6 +50,47 @@ namespace Junior
 	// ParticleEmitter
 	class ParticleEmitter : public Component<ParticleEmitter>
 	{
+	public:
+		// Public Structures
+
+		// How the particles are spawned and how they change, shared between an emitter and its copies until one of them changes it
+		struct Settings
+		{
+			// The function pointer for interpolating each particle's color
+			InterpolateVec3Ptr colorInterpolate_;
+			// The function pointer for interpolating each particle's size
+			InterpolateFloatPtr sizeInterpolate_;
+			// The starting color of the particles
+			Vec3 startColor_;
+			// The ending color of the particles
+			Vec3 endColor_;
+			// The initial spawning velocity
+			Vec3 initialVelocity_;
+			// The "minimum" acceleration
+			Vec3 startAcceleration_;
+			// The starting size of the particles
+			float startSize_;
+			// The ending size of the particles
+			float endingSize_;
+			// The maximum amount of particles we can have
+			unsigned maxParticles_;
+			// How many particles we spawn per burst
+			unsigned particleSpawnCount_;
+			// The max lifetime
+			float maxLifeTime_;
+			// The min lifetime
+			float minLifeTime_;
+			// How long we wait before spawning particles_;
+			float particleSpawnWait_;
+			// Whether the emitter loops
+			bool loop_;
+			// The spawn random angle from where we start. The angle can be from [-angle/2.0f, angle/2.0f] in degrees
+			float randomVelocityAngle_;
+
+			// Default Constructor
+			Settings();
+		};
+
 	private:
 		// Private Member Variables
 
@@ -60,6 +102,8 @@ namespace Junior
 		unsigned numParticles_;
 		// RNG
 		Random random_;
+		// The settings of the emitter
+		SharedData<Settings> settings_;
 
 		// Private Member Functions
 
@@ -67,49 +111,19 @@ namespace Junior
 		void SpawnParticles();
 
 	public:
-		// Private Member Variables
+		// Public Member Variables
 
 		// The transform of the object emitting the particles
-		Transform* transform_;
-		// The function pointer for interpolating each particle's color
-		InterpolateVec3Ptr colorInterpolate_;
-		// The function pointer for interpolating each particle's size
-		InterpolateFloatPtr sizeInterpolate_;
-		// The starting color of the particles
-		Vec3 startColor_;
-		// The ending color of the particles
-		Vec3 endColor_;
-		// The initial spawning velocity
-		Vec3 initialVelocity_;
-		// The "minimum" acceleration
-		Vec3 startAcceleration_;
-		// The starting size of the particles
-		float startSize_;
-		// The ending size of the particles
-		float endingSize_;
-		// The maximum amount of particles we can have
-		unsigned maxParticles_;
-		// How many particles we spawn per burst
-		unsigned particleSpawnCount_;
-		// The max lifetime
-		float maxLifeTime_;
-		// The min lifetime
-		float minLifeTime_;
-		// How long we wait before spawning particles_;
-		float particleSpawnWait_;
-		// Whether the emitter loops
-		bool loop_;
+		Handle<Transform> transform_;
 		// The texture atlas we are using
 		unsigned textureAtlas_;
-		// The spawn random angle from where we start. The angle can be from [-angle/2.0f, angle/2.0f] in degrees
-		float randomVelocityAngle_;
 
 		// Public Member Functions
 
 		// Constructor
 		// Params:
 		ParticleEmitter();
-		// Copy Constructor
+		// Copy Constructor, which shares the settings with the other emitter until either of them changes them
 		// Params:
 		//	other: The other particle emitter we are copying from
 		ParticleEmitter(const ParticleEmitter& other);
@@ -133,5 +147,10 @@ namespace Junior
 		std::vector<Particle>& GetParticleList();
 		// Returns: The number of particles alive in the system
 		unsigned GetNumParticlesAlive() const;
+		// Returns: The settings of the emitter
+		const Settings& GetSettings() const;
+		// Gives this emitter its own copy of the settings first when they are shared with other emitters
+		// Returns: The settings to change
+		Settings& EditSettings();
 	};
 }
\ No newline at end of file
@@ -5,12 +5,13 @@
  * File name: ParticleMesh.h
  * Description: The mesh we are using to render the particles
  * Created: 10 May 2019
- * Last Modified: 10 May 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
-#include "Mesh.h"		// Mesh
-#include "Particle.h"	// Particle
+#include "Mesh.h"			// Mesh
+#include "Particle.h"		// Particle
+#include "CullingVolume.h"	// Culling Volume
 
 namespace Junior
 {
@@ -29,8 +30,26 @@ namespace Junior
 
 		// The list of particles we want to render
 		std::vector<ParticleEmitter*> emitterParticleList_;
+		// Whether each emitter of the list is submitted, emitters of dormant objects are not
+		std::vector<bool> emitterVisible_;
 		// The buffer for all the particle data
 		unsigned particleBuffer_;
+		// The particles of an emitter that are on screen, kept around so it does not allocate every draw
+		std::vector<Particle> visibleParticles_;
+		// The number of particles drawn during the last draw
+		size_t drawnCount_;
+		// The number of living particles the last draw skipped since they were off screen
+		size_t culledCount_;
+		// The space the main camera sees, found once when the emitters are submitted
+		CullingVolume cullingVolume_;
+
+		// Private Member Functions
+
+		// Uploads and draws the particles of an emitter that are on screen
+		// Params:
+		//	emitter: The emitter
+		//	volume: The space the camera sees
+		void DrawEmitter(ParticleEmitter* emitter, const CullingVolume& volume);
 	
 	public:
 		// Public Member Functions
@@ -39,13 +58,32 @@ namespace Junior
 		ParticleMesh();
 		// Virtual Destructor
 		~ParticleMesh() override;
-		// Draws the mesh into graphics
+		// Adds a draw command for every visible emitter with living particles
+		// Params:
+		//	queue: The render queue
+		void Submit(RenderQueue& queue) override;
+		// Sets the texture atlas of an emitter's draw command
 		// Params:
+		//	command: The draw command
 		//	shaderID: The shader id we are using to render
-		void Draw(unsigned shaderID) override;
+		void BindTexture(const RenderCommand& command, unsigned shaderID) override;
+		// Draws the particles of an emitter's draw command
+		// Params:
+		//	command: The draw command
+		//	shaderID: The shader id we are using to render
+		void DrawCommand(const RenderCommand& command, unsigned shaderID) override;
 		// Adds a list to the emitter list
 		// Params:
 		//	emitterList: The particles we want to add to this list
 		void AddList(ParticleEmitter* emitterList);
+		// Sets whether an emitter's particles are submitted, they keep their place in the list while hidden
+		// Params:
+		//	emitter: The emitter
+		//	visible: Whether the particles are submitted
+		void SetEmitterVisible(const ParticleEmitter* emitter, bool visible);
+		// Returns: The number of particles drawn during the last draw
+		size_t GetDrawnParticleCount() const;
+		// Returns: The number of living particles the last draw skipped since they were off screen
+		size_t GetCulledParticleCount() const;
 	};
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
  * File name: ParticleMeshLink.h
  * Description: The mesh link used to send rendering data to the particle mesh
  * Created: 10 May 2019
- * Last Modified: 10 May 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -30,9 +30,9 @@ namespace Junior
 		// Private Member Variables
 
 		// The particle emitter this class has
-		ParticleEmitter* emitter_;
+		Handle<ParticleEmitter> emitter_;
 		// This object's sprite
-		Sprite* sprite_;
+		Handle<Sprite> sprite_;
 		
 	public:
 		// Public Member Functions
@@ -51,5 +51,16 @@ namespace Junior
 		void Update(double dt);
 		// Unloads the component
 		void Unload();
+		// Stops submitting the emitter's particles while the owner is dormant
+		void Sleep() override;
+		// Submits the emitter's particles again
+		void Wake() override;
+
+		// Public Static Functions
+
+		// Declares the component types read and written while updating
+		// Params:
+		//	access: The access being declared
+		static void DeclareAccess(ComponentAccess& access);
 	};
 }
\ No newline at end of file
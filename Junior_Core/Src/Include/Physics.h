@@ -5,7 +5,7 @@
  * File name: Physics.h
  * Description: Takes care of any physical motion
  * Created: 7 July 2019
- * Last Modified: 18 July 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -36,7 +36,7 @@ namespace Junior
 		// The position before we moved the player using the velocity
 		Vec3 prevPosition_;
 		// The object's transform
-		Transform* transform_;
+		Handle<Transform> transform_;
 	public:
 
 		// Public Member Functions
@@ -88,5 +88,12 @@ namespace Junior
 		// Gets the previous position of the object before performing physics calculations on it
 		// Returns: The object's previous position
 		const Vec3& GetPrevPosition() const;
+
+		// Public Static Functions
+
+		// Declares the component types read and written while updating
+		// Params:
+		//	access: The access being declared
+		static void DeclareAccess(ComponentAccess& access);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: PoolAllocator.h
+* Description: Hands out fixed size blocks carved from larger slabs, keeping the freed blocks in a list to be reused
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <vector>					// Vector
+#include <mutex>					// Mutex
+#include <cstddef>					// Size T
+
+namespace Junior
+{
+	class PoolAllocator
+	{
+	private:
+		// Private Structures
+
+		// A freed block, the link lives inside the block's own memory
+		struct FreeBlock
+		{
+			// The next freed block
+			FreeBlock* next_;
+		};
+
+		// Private Member Variables
+
+		// The size of every block, rounded up to the alignment
+		size_t blockSize_;
+		// The alignment of every block
+		size_t alignment_;
+		// The number of blocks in every slab
+		size_t blocksPerSlab_;
+		// The memory allocated for every slab
+		std::vector<void*> slabs_;
+		// The first freed block
+		FreeBlock* freeList_;
+		// The number of blocks handed out and not freed
+		size_t liveBlocks_;
+		// The number of blocks waiting in the free list
+		size_t freeBlocks_;
+		// Locks the free list, objects may be created from the job system's workers
+		std::mutex mutex_;
+
+		// Private Member Functions
+
+		// Allocates another slab and puts its blocks in the free list
+		void AddSlab();
+	public:
+		// Public Member Functions
+
+		// Constructor
+		// Params:
+		//	blockSize: The size in bytes of every block
+		//	alignment: The alignment in bytes of every block
+		//	blocksPerSlab: The number of blocks allocated at once when the pool runs out
+		PoolAllocator(size_t blockSize, size_t alignment, size_t blocksPerSlab = 64);
+		// Destructor releases the slabs, unless blocks are still in use
+		~PoolAllocator();
+		// Takes a block from the pool
+		// Returns: The block
+		void* Allocate();
+		// Gives a block back to the pool
+		// Params:
+		//	block: The block, which must have come from this pool
+		void Free(void* block);
+		// Returns: The size in bytes of every block
+		size_t GetBlockSize() const;
+		// Returns: The number of blocks handed out and not freed
+		size_t GetLiveCount() const;
+		// Returns: The number of blocks waiting to be reused
+		size_t GetFreeCount() const;
+		// Returns: The number of slabs allocated
+		size_t GetSlabCount() const;
+	};
+}
\ No newline at end of file
@@ -5,22 +5,53 @@
 * File name: RenderJob.h
 * Description: Describe the data Graphics is going to use to render stuff to thes screen
 * Created: 28-Apr-2018
-* Last Modified: 14-Feb-2019
+* Last Modified: 17-Oct-2026
 */
 
 // Includes //
 #include "OpenGLBundle.h"
-#include "Mat3.h"
+#include "Affine2D.h"
 #include "Vec3.h"
 
 namespace Junior
 {
+	// A stable reference to a render job of the default mesh, which keeps moving its jobs around to keep them packed together
+	struct RenderJobHandle
+	{
+		// Public Struct Variables //
+		// The slot of the indirection table pointing at the job
+		unsigned slot_ = 0;
+		// The generation of the slot when the job was made, zero for a null handle
+		unsigned generation_ = 0;
+	};
+
+	// The per instance data uploaded to the default mesh, the starter vertex shader rebuilds the full matrix from it
+	// Takes 44 bytes per instance, where a full matrix with float texture coordinates took 84
 	struct RenderJob
 	{
 		// Public Struct Variables //
-		Mat3 transformation_;
-		// Where x and y are the translation and (z, w) is the scale
-		Vec3 uvTranslationAndScale_ = Vec3(0, 0, 1.0f, 1.0f);
+		// The world transformation on the xy plane
+		Affine2D transformation_ = AffineIdentity();
+		// The world translation on the z axis
+		float depth_ = 0.0f;
+		// The translation of the texture coordinates, stored as 16 bit fractions of the atlas
+		unsigned short uvTranslation_[2] = { 0, 0 };
+		// The scale of the texture coordinates, kept as floats so flipped and tiled sprites keep their negative or big scales
+		float uvScale_[2] = { 1.0f, 1.0f };
 		unsigned int textureID_ = 0;
+
+		// Public Struct Functions //
+		// Packs the texture coordinate modifications, only the translation is clamped between 0 and 1
+		// Params:
+		//	translationAndScale: Where x and y are the translation and (z, w) is the scale
+		void SetUVTranslationAndScale(const Vec3& translationAndScale)
+		{
+			for (unsigned i = 0; i < 2; ++i)
+			{
+				float value = translationAndScale.m_[i] < 0.0f ? 0.0f : (translationAndScale.m_[i] > 1.0f ? 1.0f : translationAndScale.m_[i]);
+				uvTranslation_[i] = static_cast<unsigned short>(value * 65535.0f + 0.5f);
+				uvScale_[i] = translationAndScale.m_[i + 2];
+			}
+		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: RenderQueue.h
+* Description: Collects the draw commands of every mesh each frame and sorts them, so they are drawn in order while changing as little OpenGL state as possible
+* Created: 17-Oct-2026
+* Last Modified: 17-Oct-2026
+*/
+
+// Includes //
+#include <cstdint>				// 64 Bit Integers
+#include <vector>				// Vector
+
+namespace Junior
+{
+	// Forward Declarations
+	class DrawProgram;
+	class Mesh;
+	class Texture;
+	union Mat3;
+
+	// A single draw a mesh asks for
+	struct RenderCommand
+	{
+		// Public Struct Variables //
+		// The sort key, from the most to the least significant bits: layer, program, texture and depth
+		uint64_t key_;
+		// The program drawing the command
+		DrawProgram* program_;
+		// The mesh drawing the command
+		Mesh* mesh_;
+		// The texture the command uses, what it refers to is up to the mesh
+		unsigned texture_;
+		// What part of the mesh is drawn, up to the mesh as well
+		unsigned index_;
+	};
+
+	class RenderQueue
+	{
+	private:
+		// Private Static Constants //
+
+		// The number of bits for every part of the sort key
+		const static unsigned LAYER_BITS = 8;
+		const static unsigned PROGRAM_BITS = 8;
+		const static unsigned TEXTURE_BITS = 16;
+		const static unsigned DEPTH_BITS = 32;
+
+		// Private Member Variables //
+
+		// The commands submitted this frame, sorted once Sort is called
+		std::vector<RenderCommand> commands_;
+		// The other buffer the radix sort moves the commands into
+		std::vector<RenderCommand> sortBuffer_;
+		// The program taking the commands being submitted
+		DrawProgram* program_;
+		// The order of the program taking the commands being submitted
+		unsigned programOrder_;
+		// The number of times the last execution bound a program
+		unsigned programChanges_;
+		// The number of times the last execution bound a mesh
+		unsigned meshChanges_;
+		// The number of times the last execution bound a texture
+		unsigned textureChanges_;
+		// The number of commands the last execution drew
+		unsigned drawCount_;
+
+	public:
+		// Public Member Functions //
+
+		// Constructor
+		RenderQueue();
+		// Removes every command, called at the start of every frame
+		void Clear();
+		// Sets the program the next commands are drawn with
+		// Params:
+		//	program: The program
+		//	order: Where the program is drawn compared to the other programs in the same layer
+		void BeginProgram(DrawProgram* program, unsigned order);
+		// Adds a command drawn with the current program
+		// Params:
+		//	mesh: The mesh drawing the command
+		//	layer: The layer of the command, lower layers are drawn first
+		//	texture: The texture the command uses, commands sharing a texture are drawn together
+		//	depth: The depth of the command, lower depths are drawn first so blending is done back to front
+		//	index: What part of the mesh is drawn
+		void Push(Mesh* mesh, unsigned layer, unsigned texture, float depth, unsigned index);
+		// Sorts the commands by their keys with a radix sort, skipping the bytes every key shares
+		void Sort();
+		// Draws the commands in order, binding the program, mesh or texture only when they differ from the last command's
+		// Params:
+		//	cameraMatrix: The matrix every program draws with
+		//	textureBank: The texture array bound with every program
+		void Execute(const Mat3& cameraMatrix, Texture* textureBank);
+		// Returns: The commands submitted this frame
+		const std::vector<RenderCommand>& GetCommands() const;
+		// Returns: The number of times the last execution bound a program
+		unsigned GetProgramChangeCount() const;
+		// Returns: The number of times the last execution bound a mesh
+		unsigned GetMeshChangeCount() const;
+		// Returns: The number of times the last execution bound a texture
+		unsigned GetTextureChangeCount() const;
+		// Returns: The number of commands the last execution drew
+		unsigned GetDrawCount() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: SharedData.h
+* Description: Data shared between a component and its copies, which is only copied the first time one of them writes to it
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <memory>					// Shared Pointer
+
+namespace Junior
+{
+	// Lets copies of a component, like the instances of an archetype, share the data they do not change
+	// Copying the holder only shares the data, the data is copied the first time a holder asks to write to it
+	template <class T>
+	class SharedData
+	{
+	private:
+		// Private Member Variables
+
+		// The data, shared between every holder that has not written to it
+		std::shared_ptr<T> data_;
+	public:
+		// Public Member Functions
+
+		// Default Constructor makes new data that is not shared yet
+		SharedData()
+			: data_(std::make_shared<T>())
+		{
+		}
+
+		// Returns: The data to read from
+		const T& Read() const
+		{
+			return *data_;
+		}
+
+		// Copies the data first when it is shared with another holder
+		// Returns: The data to write to, owned only by this holder
+		T& Write()
+		{
+			if (data_.use_count() > 1)
+			{
+				data_ = std::make_shared<T>(*data_);
+			}
+			return *data_;
+		}
+
+		// Returns: Whether the data is shared with another holder
+		bool IsShared() const
+		{
+			return data_.use_count() > 1;
+		}
+	};
+}
\ No newline at end of file
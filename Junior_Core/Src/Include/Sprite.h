@@ -5,13 +5,14 @@
  * File Name: Sprite.h
  * Description: Sprites manage the raw data that comes from textures and updates the texture coordinates for texture maps
  * Created: 13 Feb 2019
- * Last Modified: 13 May 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include "Component.h"				// Component
 #include <string>					// Strings
 #include <Vec3.h>					// Vec3
+#include "SharedData.h"				// Shared Data
 
 namespace Junior
 {
@@ -24,6 +25,32 @@ namespace Junior
 	class Sprite : public Component<Sprite>
 	{
 	private:
+		// Private Structures
+
+		// The texture data, shared between a sprite and its copies until one of them changes it
+		struct Data
+		{
+			// The path to the texture
+			std::string path_;
+			// The sprite's texture
+			Texture* texture_;
+			// The node of the texture atlas we are using
+			AtlasNode* atlasNode_;
+			// The texture atlas we are using
+			TextureAtlas* atlas_;
+
+			// Default Constructor
+			Data();
+			// Copy Constructor, which loads its own copy of the texture
+			// Params:
+			//	other: The data we are copying from
+			Data(const Data& other);
+			// Destructor releases the texture
+			~Data();
+			// The data cannot be assigned, it is copied through the shared data
+			Data& operator=(const Data& other) = delete;
+		};
+
 		// Private Member Variables
 
 		// Whether we already have a spot on the texture atlas
@@ -32,14 +59,8 @@ namespace Junior
 		Vec3 atlasOffset_;
 		// The texture atlas scale
 		Vec3 atlasScale_;
-		// The path to the texture
-		std::string path_;
-		// The sprite's texture
-		Texture* texture_;
-		// The node of the texture atlas we are using
-		AtlasNode* atlasNode_;
-		// The texture atlas we are using
-		TextureAtlas* atlas_;
+		// The texture data
+		SharedData<Data> data_;
 
 	public:
 		// Public Member Functions
@@ -50,16 +71,12 @@ namespace Junior
 		// Params:
 		//	path: The path to the imag file
 		Sprite(const std::string& path);
-		// Copy Constructor
+		// Copy Constructor, which shares the texture with the other sprite until either of them changes it
 		// Params:
 		//	other: The other sprite we are trying to copy from
 		Sprite(const Sprite& other);
 		// Initializes the component
 		void Initialize() override;
-		// Updates the component
-		// Params:
-		//	dt: The time in between frames
-		void Update(double dt) override;
 		// Cleans up the component
 		// Params:
 		//	The memory manager used to create this object
@@ -103,5 +120,12 @@ namespace Junior
 		//	parser: The parser used to read the component from the file
 		// Throws: ParserException
 		void Deserialize(Parser& parser) override;
+
+		// Public Static Functions
+
+		// Declares the component types read and written while updating
+		// Params:
+		//	access: The access being declared
+		static void DeclareAccess(ComponentAccess& access);
 	};
 }
\ No newline at end of file
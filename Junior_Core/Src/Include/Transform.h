@@ -3,15 +3,17 @@
  * Author: David Wong
  * Email: david.wongcascante@digipen.edu
  * Date Created: 1 May 2018
- * Last Modified: 4 May 2019
+ * Last Modified: 17 Oct 2026
  * File name: Transform.h
  * Description: Declare the transform component, which is in charge of defining the final dimensions of the vertices in the game object
 */
 
 // Includes //
+#include <atomic>					// Atomic
 #include "Component.h"				// Component
 #include "Vec3.h"					// Vector3
 #include "Mat3.h"					// Matrix3
+#include "Affine2D.h"				// Affine 2D
 
 namespace Junior
 {
@@ -20,10 +22,26 @@ namespace Junior
 
 	class Transform : public Component<Transform>
 	{
+		// Friend Classes
+		friend class TransformHierarchy;
 	private:
 		// Private Class Variables
-		// Local Transformation
-		Mat3 localTransformation_;
+		// Local Transformation on the xy plane, the z axis is kept by the local translation and scaling
+		mutable Affine2D localTransformation_;
+		// The cached world transformation on the xy plane, valid while the world transformation is not dirty
+		mutable Affine2D globalTransformation_;
+		// The cached world translation on the z axis
+		mutable float globalDepth_;
+		// The cached world scaling on the z axis
+		mutable float globalDepthScale_;
+		// The world transformation on the xy plane from before the fixed update that last changed the transform
+		Affine2D previousTransformation_;
+		// The world translation on the z axis from before the fixed update that last changed the transform
+		float previousDepth_;
+		// The fixed update that last changed the transform
+		unsigned previousStep_;
+		// Whether the previous world transformation was up to date when it was kept
+		bool hasPrevious_;
 		// Local Translation
 		Vec3 localTranslation_;
 		// Local Scaling
@@ -31,14 +49,36 @@ namespace Junior
 		// Local Rotation
 		float localRot_;
 		// Whether the transformation matrix is dirty or not
-		bool isDirty_;
+		mutable bool isDirty_;
+		// Whether the cached world transformation is dirty or not
+		// When a transform is dirty, all of the transforms below it are dirty as well
+		mutable bool isGlobalDirty_;
 		// The object's camera
 		Camera* camera_;
+		// The depth of this transform inside the transform hierarchy, -1 when it is not in the hierarchy
+		int hierarchyLevel_;
+		// The index of this transform inside of its level of the transform hierarchy
+		size_t hierarchyIndex_;
+
+		// Private Static Variables
+
+		// The number of world transformations recomputed since the frame started, levels can be rebuilt from several threads
+		static std::atomic<unsigned> recomputedThisFrame_;
+		// The number of world transformations recomputed during the last frame
+		static unsigned recomputedLastFrame_;
+		// The number of fixed updates run so far
+		static unsigned fixedStep_;
+		// Whether a fixed update is running, only the changes made then are interpolated
+		static bool inFixedStep_;
 
 		// Private Member Functions
 		// Constructs a new transformation matrix based on the
 		// local translation, scaling, and rotation
-		void ReconstructTransformation();
+		void ReconstructTransformation() const;
+		// Rebuilds the cached world transformation from the parent's world transformation
+		// Params:
+		//	parent: The parent's transform, its world transformation must be up to date, or null when there is no parent
+		void RebuildGlobalTransformation(const Transform* parent) const;
 	public:
 		// Public Member Functions
 
@@ -49,17 +89,21 @@ namespace Junior
 		// Params:
 		//	other: The other transform
 		Transform(const Transform& other);
+		// Destructor takes the transform out of the transform hierarchy
+		~Transform();
 		// Initializes the component
 		void Initialize() override;
-		// Updates the transform
-		// Params:
-		//	ms: The delta time between frames
-		void Update(double ms) override;
 		// Cleans up the transform
 		// Params:
 		//	manager: The memory manager used to create this instance of the component
 		void Unload() override;
 		
+		// Marks the world transformation of this transform and every transform below it as dirty
+		// Stops early when this transform is already dirty, since the ones below it must be too
+		void MarkGlobalDirty();
+		// Moves the transform under its owner's new parent, called when the owner's parent changes
+		void OnParentChanged();
+
 		// Sets the local translatoin
 		// Params:
 		//	other: The translation to be set
@@ -88,9 +132,23 @@ namespace Junior
 		Vec3 GetGlobalScaling() const;
 
 		// Returns: The local transformation matrix
-		const Mat3& GetLocalTransformation() const;
-		// Returns: The global transformation matrix
-		const Mat3 GetGlobalTransformation() const;
+		Mat3 GetLocalTransformation() const;
+		// Returns: The global transformation matrix, recomputing it first if it is dirty
+		Mat3 GetGlobalTransformation() const;
+		// Returns: The global transformation on the xy plane, recomputing it first if it is dirty
+		const Affine2D& GetGlobalAffine() const;
+		// Returns: The global translation on the z axis, recomputing it first if it is dirty
+		float GetGlobalDepth() const;
+		// Blends the world transformation from before the last fixed update with the current one
+		// Params:
+		//	alpha: How far the frame is between the last fixed update and the next one
+		// Returns: The blended transformation, or the current one when the last fixed update did not change the transform
+		Affine2D GetInterpolatedAffine(float alpha) const;
+		// Blends the world translation on the z axis from before the last fixed update with the current one
+		// Params:
+		//	alpha: How far the frame is between the last fixed update and the next one
+		// Returns: The blended translation, or the current one when the last fixed update did not change the transform
+		float GetInterpolatedDepth(float alpha) const;
 		// Writes the component to a file
 		// Params:
 		//	parser: The parser used to write the component
@@ -101,5 +159,20 @@ namespace Junior
 		//	parser: The parser used to read the component from the file
 		// Throws: ParserException
 		void Deserialize(Parser& parser) override;
+
+		// Public Static Functions
+
+		// Starts counting the world transformations recomputed in a new frame
+		static void BeginFrame();
+		// Returns: The number of world transformations recomputed during the last frame
+		static unsigned GetRecomputedCount();
+		// Starts a fixed update, the transforms changed during it keep their world transformation from before it
+		static void BeginFixedStep();
+		// Ends a fixed update
+		static void EndFixedStep();
+		// Declares the component types read and written while updating
+		// Params:
+		//	access: The access being declared
+		static void DeclareAccess(ComponentAccess& access);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: TransformHierarchy.h
+* Description: Keeps every transform in flat arrays sorted by depth, so world transformations can be rebuilt level by level
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <vector>				// Vector
+#include <cstddef>				// Size T
+
+namespace Junior
+{
+	// Forward Declarations
+	class Transform;
+
+	class TransformHierarchy
+	{
+	private:
+		// Private Structures
+
+		// A transform inside of one of the levels
+		struct Entry
+		{
+			// The transform
+			Transform* transform_;
+			// The index of the parent's entry in the level above, or one of the special parent values
+			int parent_;
+		};
+
+		// Private Constants
+
+		// The entry has no parent, its world transformation is its local transformation
+		static const int noParent_ = -1;
+		// The entry has a parent transform that is not in the hierarchy, so it is left for the transform to rebuild itself
+		static const int unlinkedParent_ = -2;
+
+		// Private Member Variables
+
+		// The entries sorted by depth, the first level holds the roots
+		std::vector<std::vector<Entry>> levels_;
+		// The number of entries a level needs before it is split between the job system's workers
+		size_t parallelThreshold_;
+		// The number of changed local transformations that are built together through LinearMath's batch composition
+		size_t batchThreshold_;
+
+		// Private Member Functions
+
+		// Default Constructor
+		TransformHierarchy();
+		// Finds the transform of the parent of a transform
+		// Params:
+		//	transform: The transform whose parent we want
+		// Returns: The parent's transform, or null when there is none
+		static Transform* FindParentTransform(const Transform* transform);
+		// Places a transform at the end of a level
+		// Params:
+		//	transform: The transform to place
+		void Insert(Transform* transform);
+		// Takes a transform out of its level, moving the last entry of the level into its place
+		// Params:
+		//	transform: The transform to take out
+		void Erase(Transform* transform);
+		// Rebuilds the world transformations of a range of entries in a level
+		// Params:
+		//	level: The index of the level
+		//	begin: The first entry to rebuild
+		//	end: One past the last entry to rebuild
+		void RebuildRange(size_t level, size_t begin, size_t end);
+		// Builds the changed local transformations of a range of entries in batches, when enough of them changed
+		// Params:
+		//	level: The index of the level
+		//	begin: The first entry to look at
+		//	end: One past the last entry to look at
+		void ComposeRange(size_t level, size_t begin, size_t end);
+	public:
+		// Public Member Functions
+
+		// Adds a transform to the hierarchy, and links any of its children that were added before it
+		// Params:
+		//	transform: The transform to add
+		void Add(Transform* transform);
+		// Removes a transform from the hierarchy, its children rebuild themselves until they are linked again
+		// Params:
+		//	transform: The transform to remove
+		void Remove(Transform* transform);
+		// Moves a transform and everything below it under the transform's current parent
+		// Params:
+		//	transform: The transform whose parent changed
+		void Reparent(Transform* transform);
+		// Rebuilds every dirty world transformation, level by level, splitting big levels between the job system's workers
+		void Update();
+		// Sets the number of entries a level needs before it is split between threads
+		// Params:
+		//	threshold: The number of entries
+		void SetParallelThreshold(size_t threshold);
+		// Sets the number of changed local transformations needed before they are built together
+		// Params:
+		//	threshold: The number of transformations
+		void SetBatchThreshold(size_t threshold);
+		// Returns: The number of levels in the hierarchy
+		size_t GetLevelCount() const;
+
+		// Gets the classes' singleton
+		// Returns: The classes' singleton
+		static TransformHierarchy& GetInstance();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: UpdatePhases.h
+* Description: Groups the components of every object by type, and updates the types that do not touch each other's data at the same time
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include <vector>					// Vector
+#include <map>						// Map
+#include <cstddef>					// Size T
+#include "ArchetypeStorage.h"		// Archetype Storage
+#include "ComponentContainer.h"		// Component Type ID
+
+namespace Junior
+{
+	// Forward Declarations
+	class GameObject;
+
+	class UpdatePhases
+	{
+	private:
+		// Private Structures
+
+		// Every component of one type, updated one after another by a single thread
+		struct Batch
+		{
+			// What the type reads and writes, null when no component of the type was found this frame
+			const ComponentAccess* access_;
+			// The components living on their own
+			std::vector<ComponentContainer*> components_;
+			// The storages holding a column of this type, and the index of the column
+			std::vector<std::pair<ArchetypeStorage*, size_t>> columns_;
+			// Whether the type was placed in the update order by the last build
+			bool ordered_;
+		};
+
+		// Private Member Variables
+
+		// The batches, indexed by component type
+		std::vector<Batch> batches_;
+		// The component types in the order a serial update would first run them
+		std::vector<ComponentTypeID> order_;
+		// The component types of every wave, waves run one after another and the types inside a wave at the same time
+		std::vector<std::vector<ComponentTypeID>> waves_;
+
+		// Private Member Functions
+
+		// Finds the batch of a component type, making room for it when needed
+		// Params:
+		//	type: The identifier of the component type
+		//	access: What the type reads and writes
+		// Returns: The batch
+		Batch& GetBatch(ComponentTypeID type, const ComponentAccess* access);
+		// Places the component types of an object or a storage in the update order, the first time each type is found
+		// A new type goes right before the next type of the sequence placed already, so the types keep the order they run in
+		// Params:
+		//	types: The component types in the order the object or the storage updates them
+		void Order(const std::vector<ComponentTypeID>& types);
+		// Updates every component of a batch
+		// Params:
+		//	type: The identifier of the batch's component type
+		//	dt: The delta time
+		//	fixed: Whether this is a fixed update
+		void RunBatch(ComponentTypeID type, double dt, bool fixed);
+		// Runs every wave
+		// Params:
+		//	dt: The delta time
+		//	fixed: Whether this is a fixed update
+		void Run(double dt, bool fixed);
+	public:
+		// Public Member Functions
+
+		// Gathers the components of the objects and storages, and orders the component types into waves
+		// The types go in the order a serial update runs them, the objects' components first and then the storages' columns,
+		// and two types that conflict keep that order
+		// Only the components and columns whose types define the update being built are gathered
+		// Params:
+		//	objects: The objects whose loose components are updated, destroyed objects are skipped
+		//	storages: The archetype storages whose columns are updated
+		//	fixed: Whether the build is for the fixed update
+		void Build(const std::vector<GameObject*>& objects, const std::map<ArchetypeStorage::Key, ArchetypeStorage*>& storages, bool fixed);
+		// Updates every component gathered by the last build
+		// Params:
+		//	dt: The delta time between frames
+		void Update(double dt);
+		// Updates every component gathered by the last build at a fixed rate
+		// Params:
+		//	dt: The fixed delta time
+		void FixedUpdate(double dt);
+		// Returns: The number of waves found by the last build
+		size_t GetWaveCount() const;
+	};
+}
\ No newline at end of file
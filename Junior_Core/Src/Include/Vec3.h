@@ -3,7 +3,7 @@
  * Author: David Wong
  * Email: david.wongcascante@digipen.edu
  * Created: 24-Apr-2018
- * Last Modified: 29-Oct-2018
+ * Last Modified: 17-Oct-2026
  * Description: Declare the functionality of the Vector2 used on this game engine
  * File Name: Vec3.h
 */
@@ -11,6 +11,7 @@
 // Includes
 #include <ostream>
 #include <fstream>
+#include "MathSimd.h"			// SIMD Switches
 
 namespace Junior
 {
@@ -24,63 +25,103 @@ namespace Junior
 		};
 
 		// Public Member Functions
-		Vec3(float x = 0.0f, float y = 0.0f, float z = 0.0f, float w = 1.0f);
+		Vec3(float x = 0.0f, float y = 0.0f, float z = 0.0f, float w = 1.0f)
+		{
+			x_ = x;
+			y_ = y;
+			z_ = z;
+			w_ = w;
+		}
 
 	};
 
+#ifdef JUNIOR_MATH_SSE
+	// Helpers for the SSE versions of the vector and matrix math
+	namespace Simd
+	{
+		// Loads a vector into a register
+		// Params:
+		//	vector: The vector we are loading
+		// Returns: The x, y, z and w of the vector
+		inline __m128 Load(const Vec3& vector)
+		{
+			return _mm_loadu_ps(vector.m_);
+		}
+		// Stores a register into a vector
+		// Params:
+		//	vector: The vector we are storing to
+		//	value: The x, y, z and w we are storing
+		inline void Store(Vec3& vector, __m128 value)
+		{
+			_mm_storeu_ps(vector.m_, value);
+		}
+		// Combines the x, y and z of one register with the w of another
+		// Params:
+		//	xyz: The register we take x, y and z from
+		//	w: The register we take w from
+		// Returns: The combined register
+		inline __m128 SelectW(__m128 xyz, __m128 w)
+		{
+			const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+			return _mm_or_ps(_mm_and_ps(mask, xyz), _mm_andnot_ps(mask, w));
+		}
+	}
+#endif
+
 	// Global Operators for Vec3 //
+	// The operators leave w at 1 in the vectors they return, and leave w alone in the vectors they modify
 	// Adds two vectors together
 	// Params:
 	//	lhs: The left side of the addition
 	//	rhs: The right side of the addition
 	// Returns: The added vector
-	Vec3 operator+(const Vec3& lhs, const Vec3& rhs);
+	inline Vec3 operator+(const Vec3& lhs, const Vec3& rhs);
 	// Subtracts two vectors together
 	// Params:
 	//	lhs: The left side of the subtraction
 	//	rhs: The right side of the subtraction
 	// Returns: The subtracted vector
-	Vec3 operator-(const Vec3& lhs, const Vec3& rhs);
+	inline Vec3 operator-(const Vec3& lhs, const Vec3& rhs);
 	// Scales a vector
 	// Params:
 	//	lhs: Left hand side vector
 	//	scalar: The scalar we are multiplying by
 	// Returns: The scaled vector
-	Vec3 operator*(const Vec3& lhs, float scalar);
+	inline Vec3 operator*(const Vec3& lhs, float scalar);
 	// Scales a vector by dividing it
 	// Params:
 	//	lhs: Left hand side vector
 	//	scalar: The scalar we are dividing by
 	// Returns: The scaled vector
-	Vec3 operator/(const Vec3& lhs, float scalar);
+	inline Vec3 operator/(const Vec3& lhs, float scalar);
 	// Scales a vector
 	// Params:
 	//	scalar: The scalar we are multiplying by
 	//	rhs: Right hand side vector
 	// Returns: The scaled vector
-	Vec3 operator*(float scalar, const Vec3& rhs);
+	inline Vec3 operator*(float scalar, const Vec3& rhs);
 	// Adds one vector onto the other
 	// Params:
 	//	lhs: The vector we are adding to
 	//	rhs: The added vector
-	Vec3& operator+=(Vec3& lhs, const Vec3& rhs);
+	inline Vec3& operator+=(Vec3& lhs, const Vec3& rhs);
 	// Subtracts one vector onto another
 	// Params:
 	//	lhs: The vector we are subtractiong from
 	//	rhs: The vector we are subtracting
 	// Returns: The subtracted vector
-	Vec3& operator-=(Vec3& lhs, const Vec3& rhs);
+	inline Vec3& operator-=(Vec3& lhs, const Vec3& rhs);
 	// Scales a vector
 	// Params:
 	//	lhs: The scaled vector
 	//	scalar: The scalar
-	Vec3& operator*=(Vec3& lhs, float scalar);
+	inline Vec3& operator*=(Vec3& lhs, float scalar);
 	// Scales a vector
 	// Params:
 	//	lhs: The scaled vector
 	//	scalar: The scalar we are dividng by
 	// Returns: The scaled vector
-	Vec3& operator/=(Vec3& lhs, float scalar);
+	inline Vec3& operator/=(Vec3& lhs, float scalar);
 	// Prints a vector onto a stream
 	// Params:
 	//	stream: The output stream we are outputing to
@@ -95,7 +136,118 @@ namespace Junior
 	std::fstream& operator<<(std::fstream& stream, const Vec3& vector);
 	// Reads a vector from a file
 	// Params:
-	//	stream: The file stream we are reading from
+	//	stream: The stream we are reading from, either a file or text that was already read
 	//	vector: The vector we are saving
-	void operator>>(std::fstream& stream, Vec3& vector);
+	void operator>>(std::istream& stream, Vec3& vector);
+
+	// Inline Definitions //
+
+	inline Vec3 operator+(const Vec3& lhs, const Vec3& rhs)
+	{
+		Vec3 out;
+#ifdef JUNIOR_MATH_SSE
+		Simd::Store(out, Simd::SelectW(_mm_add_ps(Simd::Load(lhs), Simd::Load(rhs)), _mm_set1_ps(1.0f)));
+#else
+		out.x_ = lhs.x_ + rhs.x_;
+		out.y_ = lhs.y_ + rhs.y_;
+		out.z_ = lhs.z_ + rhs.z_;
+#endif
+		return out;
+	}
+
+	inline Vec3 operator-(const Vec3& lhs, const Vec3& rhs)
+	{
+		Vec3 out;
+#ifdef JUNIOR_MATH_SSE
+		Simd::Store(out, Simd::SelectW(_mm_sub_ps(Simd::Load(lhs), Simd::Load(rhs)), _mm_set1_ps(1.0f)));
+#else
+		out.x_ = lhs.x_ - rhs.x_;
+		out.y_ = lhs.y_ - rhs.y_;
+		out.z_ = lhs.z_ - rhs.z_;
+#endif
+		return out;
+	}
+
+	inline Vec3 operator*(const Vec3& lhs, float scalar)
+	{
+		Vec3 out;
+#ifdef JUNIOR_MATH_SSE
+		Simd::Store(out, Simd::SelectW(_mm_mul_ps(Simd::Load(lhs), _mm_set1_ps(scalar)), _mm_set1_ps(1.0f)));
+#else
+		out.x_ = lhs.x_ * scalar;
+		out.y_ = lhs.y_ * scalar;
+		out.z_ = lhs.z_ * scalar;
+#endif
+		return out;
+	}
+
+	inline Vec3 operator*(float scalar, const Vec3& rhs)
+	{
+		return operator*(rhs, scalar);
+	}
+
+	inline Vec3 operator/(const Vec3& lhs, float scalar)
+	{
+		Vec3 out;
+#ifdef JUNIOR_MATH_SSE
+		Simd::Store(out, Simd::SelectW(_mm_div_ps(Simd::Load(lhs), _mm_set1_ps(scalar)), _mm_set1_ps(1.0f)));
+#else
+		out.x_ = lhs.x_ / scalar;
+		out.y_ = lhs.y_ / scalar;
+		out.z_ = lhs.z_ / scalar;
+#endif
+		return out;
+	}
+
+	inline Vec3& operator+=(Vec3& lhs, const Vec3& rhs)
+	{
+#ifdef JUNIOR_MATH_SSE
+		__m128 left = Simd::Load(lhs);
+		Simd::Store(lhs, Simd::SelectW(_mm_add_ps(left, Simd::Load(rhs)), left));
+#else
+		lhs.x_ += rhs.x_;
+		lhs.y_ += rhs.y_;
+		lhs.z_ += rhs.z_;
+#endif
+		return lhs;
+	}
+
+	inline Vec3& operator-=(Vec3& lhs, const Vec3& rhs)
+	{
+#ifdef JUNIOR_MATH_SSE
+		__m128 left = Simd::Load(lhs);
+		Simd::Store(lhs, Simd::SelectW(_mm_sub_ps(left, Simd::Load(rhs)), left));
+#else
+		lhs.x_ -= rhs.x_;
+		lhs.y_ -= rhs.y_;
+		lhs.z_ -= rhs.z_;
+#endif
+		return lhs;
+	}
+
+	inline Vec3& operator*=(Vec3& lhs, float scalar)
+	{
+#ifdef JUNIOR_MATH_SSE
+		__m128 left = Simd::Load(lhs);
+		Simd::Store(lhs, Simd::SelectW(_mm_mul_ps(left, _mm_set1_ps(scalar)), left));
+#else
+		lhs.x_ *= scalar;
+		lhs.y_ *= scalar;
+		lhs.z_ *= scalar;
+#endif
+		return lhs;
+	}
+
+	inline Vec3& operator/=(Vec3& lhs, float scalar)
+	{
+#ifdef JUNIOR_MATH_SSE
+		__m128 left = Simd::Load(lhs);
+		Simd::Store(lhs, Simd::SelectW(_mm_div_ps(left, _mm_set1_ps(scalar)), left));
+#else
+		lhs.x_ /= scalar;
+		lhs.y_ /= scalar;
+		lhs.z_ /= scalar;
+#endif
+		return lhs;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,349 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: ActivationSystem.cpp
+* Description: Puts tracked objects to sleep outside of a region around the main camera, and wakes them up when they come back in
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "ActivationSystem.h"		// Activation System
+#include "GameObject.h"				// Game Object
+#include "Transform.h"				// Transform
+#include "Camera.h"					// Camera
+#include "Graphics.h"				// Graphics
+#include <cmath>					// Floor
+#include <algorithm>				// Max
+
+// Private Member Functions
+
+// The region starts sized for the 1920 by 1080 camera of the default level, until it follows the main camera
+Junior::ActivationSystem::ActivationSystem()
+	: entries_(), cells_(), awake_(), cellSize_(2880.0f), regionExtents_(1440.0f, 810.0f, 0.0f), regionMargin_(0.25f), fixedRegion_(false), fixedCellSize_(false),
+	sleepDelay_(1.0), trackAdded_(false)
+{
+}
+
+long long Junior::ActivationSystem::MakeCell(long long x, long long y)
+{
+	// The column goes into the top half and the row into the bottom half, negative cells included
+	return static_cast<long long>((static_cast<unsigned long long>(x) << 32) ^ (static_cast<unsigned long long>(y) & 0xFFFFFFFFull));
+}
+
+bool Junior::ActivationSystem::FindPosition(const GameObject* object, Vec3& position)
+{
+	const Transform* transform = object->GetComponent<Transform>();
+	if (!transform)
+	{
+		return false;
+	}
+	position = transform->GetGlobalTranslation();
+	return true;
+}
+
+void Junior::ActivationSystem::Insert(GameObject* object, Entry& entry)
+{
+	if (!entry.dormant_)
+	{
+		entry.slot_ = awake_.size();
+		awake_.push_back(object);
+		return;
+	}
+
+	Vec3 position;
+	FindPosition(object, position);
+	entry.cell_ = MakeCell(static_cast<long long>(std::floor(position.x_ / cellSize_)), static_cast<long long>(std::floor(position.y_ / cellSize_)));
+	std::vector<GameObject*>& cell = cells_[entry.cell_];
+	entry.slot_ = cell.size();
+	cell.push_back(object);
+}
+
+void Junior::ActivationSystem::Erase(Entry& entry)
+{
+	std::vector<GameObject*>* list = &awake_;
+	auto cell = cells_.end();
+	if (entry.dormant_)
+	{
+		cell = cells_.find(entry.cell_);
+		list = &cell->second;
+	}
+
+	GameObject* last = list->back();
+	(*list)[entry.slot_] = last;
+	entries_[last].slot_ = entry.slot_;
+	list->pop_back();
+
+	// Empty cells are dropped so the map only holds cells with dormant objects
+	if (entry.dormant_ && list->empty())
+	{
+		cells_.erase(cell);
+	}
+}
+
+void Junior::ActivationSystem::PutToSleep(GameObject* object, Entry& entry)
+{
+	Erase(entry);
+	entry.dormant_ = true;
+	Insert(object, entry);
+	object->SetSleeping(true);
+}
+
+void Junior::ActivationSystem::WakeUp(GameObject* object, Entry& entry)
+{
+	Erase(entry);
+	entry.dormant_ = false;
+	entry.outsideTime_ = 0.0;
+	Insert(object, entry);
+	object->SetSleeping(false);
+}
+
+void Junior::ActivationSystem::Rehash(float size)
+{
+	if (size == cellSize_ || size <= 0.0f)
+	{
+		return;
+	}
+	cellSize_ = size;
+
+	// The dormant objects are hashed again, so the region and wake areas keep finding them
+	cells_.clear();
+	for (auto& entry : entries_)
+	{
+		if (entry.second.dormant_)
+		{
+			Insert(entry.first, entry.second);
+		}
+	}
+}
+
+void Junior::ActivationSystem::FitRegion(const Camera& camera)
+{
+	if (!fixedRegion_)
+	{
+		float scale = 0.5f + regionMargin_;
+		regionExtents_ = Vec3(camera.GetWidth() * scale, camera.GetHeight() * scale, 0.0f);
+	}
+	// The region then only ever overlaps a few cells, and the cells only change when the view does
+	if (!fixedCellSize_)
+	{
+		Rehash(2.0f * std::max(regionExtents_.x_, regionExtents_.y_));
+	}
+}
+
+void Junior::ActivationSystem::WakeInside(const Vec3& center, const Vec3& extents)
+{
+	// Only the cells overlapping the area are looked at, so the cost follows the area instead of the number of dormant objects
+	long long minX = static_cast<long long>(std::floor((center.x_ - extents.x_) / cellSize_));
+	long long maxX = static_cast<long long>(std::floor((center.x_ + extents.x_) / cellSize_));
+	long long minY = static_cast<long long>(std::floor((center.y_ - extents.y_) / cellSize_));
+	long long maxY = static_cast<long long>(std::floor((center.y_ + extents.y_) / cellSize_));
+
+	std::vector<GameObject*> waking;
+	for (long long x = minX; x <= maxX; ++x)
+	{
+		for (long long y = minY; y <= maxY; ++y)
+		{
+			auto cell = cells_.find(MakeCell(x, y));
+			if (cell == cells_.end())
+			{
+				continue;
+			}
+			for (GameObject* object : cell->second)
+			{
+				Vec3 position;
+				FindPosition(object, position);
+				if (std::fabs(position.x_ - center.x_) <= extents.x_ && std::fabs(position.y_ - center.y_) <= extents.y_)
+				{
+					waking.push_back(object);
+				}
+			}
+		}
+	}
+
+	// Waking changes the cells, so the objects are gathered first
+	for (GameObject* object : waking)
+	{
+		WakeUp(object, entries_[object]);
+	}
+}
+
+Junior::Camera* Junior::ActivationSystem::FindFocus()
+{
+	Camera* camera = Graphics::GetInstance().mainCamera_;
+	if (!camera || !camera->GetOwner())
+	{
+		return nullptr;
+	}
+	return camera;
+}
+
+// Public Member Functions
+
+bool Junior::ActivationSystem::Track(GameObject* object)
+{
+	if (entries_.find(object) != entries_.end())
+	{
+		return true;
+	}
+	Vec3 position;
+	if (!FindPosition(object, position))
+	{
+		return false;
+	}
+
+	Entry& entry = entries_[object];
+	entry.dormant_ = false;
+	entry.cell_ = 0;
+	entry.slot_ = 0;
+	entry.outsideTime_ = 0.0;
+	Insert(object, entry);
+	return true;
+}
+
+void Junior::ActivationSystem::Untrack(GameObject* object)
+{
+	auto found = entries_.find(object);
+	if (found == entries_.end())
+	{
+		return;
+	}
+
+	Erase(found->second);
+	bool dormant = found->second.dormant_;
+	entries_.erase(found);
+	if (dormant)
+	{
+		object->SetSleeping(false);
+	}
+}
+
+void Junior::ActivationSystem::SetDormant(GameObject* object)
+{
+	if (!Track(object))
+	{
+		return;
+	}
+	Entry& entry = entries_[object];
+	if (!entry.dormant_)
+	{
+		PutToSleep(object, entry);
+	}
+}
+
+void Junior::ActivationSystem::Wake(GameObject* object)
+{
+	auto found = entries_.find(object);
+	if (found == entries_.end())
+	{
+		return;
+	}
+	if (found->second.dormant_)
+	{
+		WakeUp(object, found->second);
+	}
+	found->second.outsideTime_ = 0.0;
+}
+
+void Junior::ActivationSystem::WakeArea(const Vec3& center, const Vec3& extents)
+{
+	WakeInside(center, extents);
+}
+
+void Junior::ActivationSystem::Update(double dt)
+{
+	const Camera* camera = FindFocus();
+	const Transform* focus = camera ? camera->GetOwner()->GetComponent<Transform>() : nullptr;
+	if (!focus || entries_.empty())
+	{
+		return;
+	}
+	FitRegion(*camera);
+	Vec3 center = focus->GetGlobalTranslation();
+
+	// Wake up the dormant objects that are now inside of the region
+	WakeInside(center, regionExtents_);
+
+	// Then put the awake objects that stayed outside for long enough to sleep, going backwards since sleeping ones leave the list
+	for (size_t i = awake_.size(); i > 0; --i)
+	{
+		GameObject* object = awake_[i - 1];
+		Entry& entry = entries_[object];
+		Vec3 position;
+		FindPosition(object, position);
+		if (std::fabs(position.x_ - center.x_) <= regionExtents_.x_ && std::fabs(position.y_ - center.y_) <= regionExtents_.y_)
+		{
+			entry.outsideTime_ = 0.0;
+			continue;
+		}
+
+		entry.outsideTime_ += dt;
+		if (entry.outsideTime_ >= sleepDelay_)
+		{
+			PutToSleep(object, entry);
+		}
+	}
+}
+
+void Junior::ActivationSystem::Clear()
+{
+	for (auto& entry : entries_)
+	{
+		if (entry.second.dormant_)
+		{
+			entry.first->SetSleeping(false);
+		}
+	}
+	entries_.clear();
+	cells_.clear();
+	awake_.clear();
+}
+
+void Junior::ActivationSystem::SetRegionExtents(const Vec3& extents)
+{
+	regionExtents_ = extents;
+	fixedRegion_ = true;
+}
+
+void Junior::ActivationSystem::SetRegionMargin(float margin)
+{
+	regionMargin_ = margin;
+	fixedRegion_ = false;
+}
+
+void Junior::ActivationSystem::SetCellSize(float size)
+{
+	fixedCellSize_ = true;
+	Rehash(size);
+}
+
+void Junior::ActivationSystem::SetSleepDelay(double delay)
+{
+	sleepDelay_ = delay;
+}
+
+void Junior::ActivationSystem::SetTrackAdded(bool track)
+{
+	trackAdded_ = track;
+}
+
+bool Junior::ActivationSystem::IsTrackingAdded() const
+{
+	return trackAdded_;
+}
+
+size_t Junior::ActivationSystem::GetDormantCount() const
+{
+	return entries_.size() - awake_.size();
+}
+
+size_t Junior::ActivationSystem::GetAwakeCount() const
+{
+	return awake_.size();
+}
+
+Junior::ActivationSystem& Junior::ActivationSystem::GetInstance()
+{
+	static ActivationSystem singleton_;
+	return singleton_;
+}
\ No newline at end of file
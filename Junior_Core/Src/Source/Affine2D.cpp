@@ -0,0 +1,41 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: Affine2D.cpp
+* Description: Implement the parts of the affine transformation math that are not inline
+* Created: 17-Oct-2026
+* Last Modified: 17-Oct-2026
+*/
+
+// Includes //
+#include "Affine2D.h"
+#include <cmath>			// Absolute Value
+
+// The composition and point transformations are defined inline in Affine2D.h
+
+Junior::Affine2D Junior::Inverse(const Affine2D& affine)
+{
+	float determinant = affine.m00_ * affine.m11_ - affine.m01_ * affine.m10_;
+	if (fabsf(determinant) <= 1e-12f)
+	{
+		return AffineIdentity();
+	}
+
+	// The inverse of the 2x2 part, then the translation taken back through it
+	float inverseDeterminant = 1.0f / determinant;
+	Affine2D out;
+	out.m00_ = affine.m11_ * inverseDeterminant;
+	out.m10_ = -affine.m10_ * inverseDeterminant;
+	out.m01_ = -affine.m01_ * inverseDeterminant;
+	out.m11_ = affine.m00_ * inverseDeterminant;
+	out.m02_ = -(out.m00_ * affine.m02_ + out.m01_ * affine.m12_);
+	out.m12_ = -(out.m10_ * affine.m02_ + out.m11_ * affine.m12_);
+	return out;
+}
+
+std::ostream& Junior::operator<<(std::ostream& stream, const Affine2D& affine)
+{
+	stream << "[ " << affine.m00_ << " " << affine.m01_ << " " << affine.m02_ << " , "
+		<< affine.m10_ << " " << affine.m11_ << " " << affine.m12_ << " ]";
+	return stream;
+}
\ No newline at end of file
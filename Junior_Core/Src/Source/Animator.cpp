@@ -4,7 +4,7 @@
  * File name: Animator.h
  * Description: Defines how the animator is going to work
  * Created: 14 Feb 2019
- * Last Modified: 26 Apr 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -16,22 +16,25 @@
 #include "Texture.h"			// Texture
 #include "Parser.h"				// Parser
 
+// Private Structures
+
+Junior::Animator::Frames::Frames(unsigned columns, unsigned rows)
+	: numRows_(rows), numColumns_(columns), node_(nullptr), startXOffset_(0), startYOffset_(0), textureXSize_(0), textureYSize_(0),
+	columnSize_(0), rowSize_(0)
+{
+}
+
 // Public Member Functions
 Junior::Animator::Animator(unsigned columns, unsigned rows)
-	: Component(), currentFrame_(0), playing_(false), loop_(false), start_(0), end_(0), 
-	numColumns_(columns), numRows_(rows), timer_(0.0), timePerFrame_(0.0), sprite_(nullptr),
-	startXOffset_(0), startYOffset_(0), textureXSize_(0), textureYSize_(0), columnSize_(0),
-	rowSize_(0)
+	: Component(), currentFrame_(0), playing_(false), loop_(false), start_(0), end_(0), timer_(0.0), timePerFrame_(0.0), frames_(), sprite_(nullptr)
 {
+	frames_.Write() = Frames(columns, rows);
 }
 
 Junior::Animator::Animator(const Animator& other)
 	: Component(), currentFrame_(other.currentFrame_), playing_(other.playing_), loop_(other.loop_), start_(other.start_),
-	end_(other.end_), numColumns_(other.numColumns_), numRows_(other.numRows_), timer_(other.timer_), timePerFrame_(other.timePerFrame_),
-	startXOffset_(0), startYOffset_(0), textureXSize_(other.textureXSize_),
-	textureYSize_(other.textureYSize_), columnSize_(other.columnSize_), rowSize_(other.rowSize_)
+	end_(other.end_), timer_(other.timer_), timePerFrame_(other.timePerFrame_), frames_(other.frames_)
 {
-	
 }
 
 void Junior::Animator::Initialize()
@@ -40,18 +43,23 @@ void Junior::Animator::Initialize()
 	sprite_ = owner_->GetComponent<Sprite>();
 	//sprite_ = static_cast<Sprite*>(owner_->GetComponent("Sprite"));
 	AtlasNode* node = sprite_->GetNode();
-	// Get the atlas
-	Graphics& graphics = Graphics::GetInstance();
-	TextureAtlas* atlas = graphics.GetTextureAtlas();
-	// Set the offsets
-	startXOffset_ = static_cast<float>(node->xPos_) / static_cast<float>(atlas->GetWidth());
-	startYOffset_ = static_cast<float>(node->yPos_) / static_cast<float>(atlas->GetHeight());
-	// Set the row and column size
-	Texture* texture = sprite_->GetTexture();
-	textureXSize_ = static_cast<float>(node->width_) / static_cast<float>(atlas->GetWidth());
-	textureYSize_ = static_cast<float>(node->height_) / static_cast<float>(atlas->GetHeight());
-	columnSize_ = textureXSize_ / static_cast<float>(numColumns_);
-	rowSize_ = textureYSize_ / static_cast<float>(numRows_);
+	// Copies of an animator that was already initialized share the sprite's node, and find the frames already measured
+	if (frames_.Read().node_ != node)
+	{
+		Frames& frames = frames_.Write();
+		// Get the atlas
+		Graphics& graphics = Graphics::GetInstance();
+		TextureAtlas* atlas = graphics.GetTextureAtlas();
+		// Set the offsets
+		frames.node_ = node;
+		frames.startXOffset_ = static_cast<float>(node->xPos_) / static_cast<float>(atlas->GetWidth());
+		frames.startYOffset_ = static_cast<float>(node->yPos_) / static_cast<float>(atlas->GetHeight());
+		// Set the row and column size
+		frames.textureXSize_ = static_cast<float>(node->width_) / static_cast<float>(atlas->GetWidth());
+		frames.textureYSize_ = static_cast<float>(node->height_) / static_cast<float>(atlas->GetHeight());
+		frames.columnSize_ = frames.textureXSize_ / static_cast<float>(frames.numColumns_);
+		frames.rowSize_ = frames.textureYSize_ / static_cast<float>(frames.numRows_);
+	}
 	// Start rendering the first frame
 	SetFrame(currentFrame_);
 }
@@ -105,9 +113,10 @@ void Junior::Animator::Stop()
 
 void Junior::Animator::SetFrame(unsigned frame)
 {
-	float u = startXOffset_ + columnSize_ * static_cast<float>((frame % numColumns_));
-	float v = startYOffset_ + textureYSize_ - rowSize_ * (1 + (frame / numColumns_));
-	sprite_->SetUVModifications(u, v, columnSize_, rowSize_);
+	const Frames& frames = frames_.Read();
+	float u = frames.startXOffset_ + frames.columnSize_ * static_cast<float>((frame % frames.numColumns_));
+	float v = frames.startYOffset_ + frames.textureYSize_ - frames.rowSize_ * (1 + (frame / frames.numColumns_));
+	sprite_->SetUVModifications(u, v, frames.columnSize_, frames.rowSize_);
 	currentFrame_ = frame;
 }
 
@@ -123,8 +132,8 @@ void Junior::Animator::Serialize(Parser& parser) const
 	parser.WriteVariable("loop", loop_);
 	parser.WriteVariable("animStart", start_);
 	parser.WriteVariable("animEnd", end_);
-	parser.WriteVariable("numColumns", numColumns_);
-	parser.WriteVariable("numRows", numRows_);
+	parser.WriteVariable("numColumns", frames_.Read().numColumns_);
+	parser.WriteVariable("numRows", frames_.Read().numRows_);
 	parser.WriteVariable("timePerFrame", timePerFrame_);
 }
 
@@ -135,7 +144,18 @@ void Junior::Animator::Deserialize(Parser& parser)
 	parser.ReadVariable("loop", loop_);
 	parser.ReadVariable("animStart", start_);
 	parser.ReadVariable("animEnd", end_);
-	parser.ReadVariable("numColumns", numColumns_);
-	parser.ReadVariable("numRows", numRows_);
+	// The layout changed, so the frames are measured again when the animator is initialized
+	Frames& frames = frames_.Write();
+	parser.ReadVariable("numColumns", frames.numColumns_);
+	parser.ReadVariable("numRows", frames.numRows_);
+	frames.node_ = nullptr;
 	parser.ReadVariable("timePerFrame", timePerFrame_);
+}
+
+// Public Static Functions
+
+void Junior::Animator::DeclareAccess(ComponentAccess& access)
+{
+	// The animator changes the frame shown by the sprite
+	access.Writes<Sprite>();
 }
\ No newline at end of file
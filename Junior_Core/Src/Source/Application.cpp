@@ -4,7 +4,7 @@
 * File name: Application.cpp
 * Description: Encapsulates all of the engines components under one class
 * Created: 27 Mar 2019
-* Last Modified: 10 Sep 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -19,6 +19,7 @@
 #include "ResourceManager.h"		// Resource Manager
 #include "GameObjectManager.h"		// Game Object Manager
 #include "EventManager.h"			// Event Manager
+#include "JobSystem.h"				// Job System
 #include "Event.h"					// Event
 
 #include "Space.h"					// Space
@@ -48,6 +49,8 @@ Junior::Application::Application(Junior::Level* startingLevel)
 	// Time always goes first because it doesn't matter what dt it updates to while
 	// the rest of the systems do care what the dt is
 	AddGameSystem<Time>();
+	// The job system starts its workers before any of the other systems can hand it jobs
+	AddGameSystem<JobSystem>();
 	AddGameSystem<Input>();
 	AddGameSystem<ResourceManager>();
 	AddGameSystem<EventManager>();
@@ -0,0 +1,292 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: ArchetypeStorage.cpp
+* Description: Stores the components of every object sharing the same set of component types in contiguous, per-type columns
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "ArchetypeStorage.h"			// Archetype Storage
+#include <algorithm>					// Sort
+#include <cstdint>						// Uintptr_t
+#include "ComponentContainer.h"			// Component Container
+
+// Private Member Functions
+
+void Junior::ArchetypeStorage::AddChunk()
+{
+	Chunk chunk;
+	// Over allocate so that the data can start at the biggest alignment of the columns
+	chunk.memory_ = new unsigned char[chunkBytes_ + alignment_];
+	std::uintptr_t address = reinterpret_cast<std::uintptr_t>(chunk.memory_);
+	chunk.data_ = chunk.memory_ + ((alignment_ - address % alignment_) % alignment_);
+	chunk.active_.assign(rowsPerChunk_ * columns_.size(), 0);
+	chunk.owners_.assign(rowsPerChunk_, nullptr);
+	chunk.used_ = 0;
+	chunks_.push_back(chunk);
+
+	// Hand out the rows from the front of the chunk first so the columns stay as dense as possible
+	size_t firstRow = (chunks_.size() - 1) * rowsPerChunk_;
+	for (size_t i = rowsPerChunk_; i > 0; --i)
+	{
+		freeRows_.push_back(firstRow + i - 1);
+	}
+}
+
+unsigned char* Junior::ArchetypeStorage::GetAddress(size_t row, size_t column) const
+{
+	const Chunk& chunk = chunks_[row / rowsPerChunk_];
+	return chunk.data_ + columns_[column].offset_ + (row % rowsPerChunk_) * columns_[column].layout_->size_;
+}
+
+size_t Junior::ArchetypeStorage::FindColumn(size_t row, const ComponentContainer* component) const
+{
+	for (size_t i = 0; i < columns_.size(); ++i)
+	{
+		if (GetAddress(row, i) == reinterpret_cast<const unsigned char*>(component))
+		{
+			return i;
+		}
+	}
+
+	return columns_.size();
+}
+
+// Public Member Functions
+
+Junior::ArchetypeStorage::ArchetypeStorage(const std::vector<ComponentContainer*>& prototypes)
+	: key_(MakeKey(prototypes)), columns_(), chunks_(), freeRows_(), rowsPerChunk_(1), chunkBytes_(0), alignment_(1), liveRows_(0)
+{
+	// Find out how many bytes a single row takes
+	size_t rowBytes = 0;
+	for (const ComponentContainer* prototype : prototypes)
+	{
+		const ComponentLayout& layout = prototype->GetLayout();
+		rowBytes += layout.size_;
+		alignment_ = std::max(alignment_, layout.alignment_);
+	}
+	if (rowBytes > 0 && rowBytes < chunkTargetBytes_)
+	{
+		rowsPerChunk_ = chunkTargetBytes_ / rowBytes;
+	}
+
+	// Then lay the columns out one after the other, respecting each one's alignment
+	for (const ComponentContainer* prototype : prototypes)
+	{
+		const ComponentLayout& layout = prototype->GetLayout();
+		chunkBytes_ = (chunkBytes_ + layout.alignment_ - 1) / layout.alignment_ * layout.alignment_;
+		Column column = { &layout, chunkBytes_ };
+		columns_.push_back(column);
+		chunkBytes_ += layout.size_ * rowsPerChunk_;
+	}
+}
+
+Junior::ArchetypeStorage::~ArchetypeStorage()
+{
+	// Destroy whatever is left in the storage
+	for (size_t chunkIndex = 0; chunkIndex < chunks_.size(); ++chunkIndex)
+	{
+		for (size_t i = 0; i < chunks_[chunkIndex].used_; ++i)
+		{
+			if (chunks_[chunkIndex].owners_[i])
+			{
+				Release(chunkIndex * rowsPerChunk_ + i);
+			}
+		}
+		delete[] chunks_[chunkIndex].memory_;
+	}
+}
+
+size_t Junior::ArchetypeStorage::Insert(GameObject* owner, const std::vector<ComponentContainer*>& prototypes, std::vector<ComponentContainer*>& components)
+{
+	if (freeRows_.empty())
+	{
+		AddChunk();
+	}
+	size_t row = freeRows_.back();
+	freeRows_.pop_back();
+	Chunk& chunk = chunks_[row / rowsPerChunk_];
+	size_t localRow = row % rowsPerChunk_;
+	chunk.owners_[localRow] = owner;
+	chunk.used_ = std::max(chunk.used_, localRow + 1);
+	++liveRows_;
+
+	// Every prototype component takes the first unclaimed column of its type
+	std::vector<bool> claimed(columns_.size(), false);
+	for (const ComponentContainer* prototype : prototypes)
+	{
+		const ComponentLayout& layout = prototype->GetLayout();
+		for (size_t i = 0; i < columns_.size(); ++i)
+		{
+			if (!claimed[i] && *columns_[i].layout_->type_ == *layout.type_)
+			{
+				claimed[i] = true;
+				ComponentContainer* clone = prototype->CloneInto(GetAddress(row, i));
+				clone->SetOwner(owner);
+				clone->SetStored(true);
+				components.push_back(clone);
+				chunk.active_[i * rowsPerChunk_ + localRow] = 1;
+				break;
+			}
+		}
+	}
+
+	return row;
+}
+
+void Junior::ArchetypeStorage::Reserve(size_t rows)
+{
+	while (freeRows_.size() < rows)
+	{
+		AddChunk();
+	}
+}
+
+void Junior::ArchetypeStorage::Activate(size_t row, const std::vector<ComponentContainer*>& components)
+{
+	Chunk& chunk = chunks_[row / rowsPerChunk_];
+	for (const ComponentContainer* component : components)
+	{
+		size_t column = FindColumn(row, component);
+		if (column < columns_.size())
+		{
+			chunk.active_[column * rowsPerChunk_ + row % rowsPerChunk_] = 1;
+		}
+	}
+}
+
+void Junior::ArchetypeStorage::Deactivate(size_t row)
+{
+	Chunk& chunk = chunks_[row / rowsPerChunk_];
+	for (size_t i = 0; i < columns_.size(); ++i)
+	{
+		chunk.active_[i * rowsPerChunk_ + row % rowsPerChunk_] = 0;
+	}
+}
+
+void Junior::ArchetypeStorage::Detach(size_t row, const ComponentContainer* component)
+{
+	size_t column = FindColumn(row, component);
+	if (column < columns_.size())
+	{
+		chunks_[row / rowsPerChunk_].active_[column * rowsPerChunk_ + row % rowsPerChunk_] = 0;
+	}
+}
+
+void Junior::ArchetypeStorage::Release(size_t row)
+{
+	Chunk& chunk = chunks_[row / rowsPerChunk_];
+	size_t localRow = row % rowsPerChunk_;
+	if (!chunk.owners_[localRow])
+	{
+		return;
+	}
+
+	for (size_t i = 0; i < columns_.size(); ++i)
+	{
+		columns_[i].layout_->destroy_(GetAddress(row, i));
+		chunk.active_[i * rowsPerChunk_ + localRow] = 0;
+	}
+	chunk.owners_[localRow] = nullptr;
+	freeRows_.push_back(row);
+	--liveRows_;
+}
+
+void Junior::ArchetypeStorage::Update(double ms)
+{
+	for (size_t i = 0; i < columns_.size(); ++i)
+	{
+		// Types without their own Update are never walked
+		if (!columns_[i].layout_->updateColumn_)
+		{
+			continue;
+		}
+		// Objects may be created while updating, which can add chunks, so index instead of holding references
+		for (size_t chunkIndex = 0; chunkIndex < chunks_.size(); ++chunkIndex)
+		{
+			Chunk& chunk = chunks_[chunkIndex];
+			columns_[i].layout_->updateColumn_(chunk.data_ + columns_[i].offset_, chunk.active_.data() + i * rowsPerChunk_, chunk.used_, ms);
+		}
+	}
+}
+
+void Junior::ArchetypeStorage::FixedUpdate(double ms)
+{
+	for (size_t i = 0; i < columns_.size(); ++i)
+	{
+		if (!columns_[i].layout_->fixedUpdateColumn_)
+		{
+			continue;
+		}
+		// Objects may be created while updating, which can add chunks, so index instead of holding references
+		for (size_t chunkIndex = 0; chunkIndex < chunks_.size(); ++chunkIndex)
+		{
+			Chunk& chunk = chunks_[chunkIndex];
+			columns_[i].layout_->fixedUpdateColumn_(chunk.data_ + columns_[i].offset_, chunk.active_.data() + i * rowsPerChunk_, chunk.used_, ms);
+		}
+	}
+}
+
+void Junior::ArchetypeStorage::UpdateColumn(size_t column, size_t beginChunk, size_t endChunk, double ms)
+{
+	if (!columns_[column].layout_->updateColumn_)
+	{
+		return;
+	}
+	for (size_t chunkIndex = beginChunk; chunkIndex < endChunk; ++chunkIndex)
+	{
+		Chunk& chunk = chunks_[chunkIndex];
+		columns_[column].layout_->updateColumn_(chunk.data_ + columns_[column].offset_, chunk.active_.data() + column * rowsPerChunk_, chunk.used_, ms);
+	}
+}
+
+void Junior::ArchetypeStorage::FixedUpdateColumn(size_t column, size_t beginChunk, size_t endChunk, double ms)
+{
+	if (!columns_[column].layout_->fixedUpdateColumn_)
+	{
+		return;
+	}
+	for (size_t chunkIndex = beginChunk; chunkIndex < endChunk; ++chunkIndex)
+	{
+		Chunk& chunk = chunks_[chunkIndex];
+		columns_[column].layout_->fixedUpdateColumn_(chunk.data_ + columns_[column].offset_, chunk.active_.data() + column * rowsPerChunk_, chunk.used_, ms);
+	}
+}
+
+size_t Junior::ArchetypeStorage::GetColumnCount() const
+{
+	return columns_.size();
+}
+
+const Junior::ComponentLayout& Junior::ArchetypeStorage::GetColumnLayout(size_t column) const
+{
+	return *columns_[column].layout_;
+}
+
+size_t Junior::ArchetypeStorage::GetChunkCount() const
+{
+	return chunks_.size();
+}
+
+const Junior::ArchetypeStorage::Key& Junior::ArchetypeStorage::GetKey() const
+{
+	return key_;
+}
+
+size_t Junior::ArchetypeStorage::GetLiveRows() const
+{
+	return liveRows_;
+}
+
+Junior::ArchetypeStorage::Key Junior::ArchetypeStorage::MakeKey(const std::vector<ComponentContainer*>& components)
+{
+	Key key;
+	for (const ComponentContainer* component : components)
+	{
+		key.push_back(std::type_index(*component->GetLayout().type_));
+	}
+	std::sort(key.begin(), key.end());
+	return key;
+}
\ No newline at end of file
@@ -4,7 +4,7 @@
 * File name: Camera.h
 * Description: Describes how the camera works
 * Created: 18 Feb 2019
-* Last Modified: 10 Sep 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -48,11 +48,6 @@ void Junior::Camera::Initialize()
 	// Create the projection matrix
 }
 
-void Junior::Camera::Update(double dt)
-{
-
-}
-
 void Junior::Camera::Unload()
 {
 }
@@ -149,7 +144,7 @@ std::fstream& Junior::operator<<(std::fstream& stream, const ProjectionMode&  mo
 	return stream;
 }
 
-void Junior::operator>>(std::fstream& stream, ProjectionMode& mode)
+void Junior::operator>>(std::istream& stream, ProjectionMode& mode)
 {
 	std::string modeName;
 	stream >> modeName;
@@ -166,4 +161,11 @@ void Junior::operator>>(std::fstream& stream, ProjectionMode& mode)
 	{
 		mode = ProjectionMode::NONE;
 	}
+}
+
+// Public Static Functions
+
+void Junior::Camera::DeclareAccess(ComponentAccess&)
+{
+	// Cameras do not touch any other component while updating
 }
\ No newline at end of file
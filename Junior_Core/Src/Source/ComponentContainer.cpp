@@ -5,16 +5,105 @@
 * File name: ComponentContainer.cpp
 * Description: Wraps around a component
 * Created: 8 Apr 2019
-* Last Modified: 26 Apr 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include "ComponentContainer.h"		// Component Container
 #include "Component.h"				// Component
+#include "GameObject.h"				// Game Object
+#include <unordered_map>			// Unordered Map
+#include <mutex>					// Mutex
+#include <shared_mutex>			// Shared Timed Mutex
+#include <algorithm>				// Find
+
+namespace
+{
+	// The identifiers of every registered component type, keyed by the name of the type
+	std::unordered_map<std::string, Junior::ComponentTypeID>& GetTypeRegistry()
+	{
+		static std::unordered_map<std::string, Junior::ComponentTypeID> registry;
+		return registry;
+	}
+
+	// Guards the registry, since types may be registered the first time they are constructed
+	// Lookups only share the lock, so components finding types by name during a parallel update do not wait on each other
+	std::shared_timed_mutex& GetTypeRegistryMutex()
+	{
+		static std::shared_timed_mutex mutex;
+		return mutex;
+	}
+}
+
+// Component Access
+
+void Junior::ComponentAccess::Reads(ComponentTypeID type)
+{
+	if (std::find(reads_.begin(), reads_.end(), type) == reads_.end())
+	{
+		reads_.push_back(type);
+	}
+}
+
+void Junior::ComponentAccess::Writes(ComponentTypeID type)
+{
+	if (std::find(writes_.begin(), writes_.end(), type) == writes_.end())
+	{
+		writes_.push_back(type);
+	}
+}
+
+void Junior::ComponentAccess::WritesResource(const void* resource)
+{
+	if (std::find(resources_.begin(), resources_.end(), resource) == resources_.end())
+	{
+		resources_.push_back(resource);
+	}
+}
+
+bool Junior::ComponentAccess::ConflictsWith(const ComponentAccess& other) const
+{
+	if (exclusive_ || other.exclusive_)
+	{
+		return true;
+	}
+
+	for (const void* resource : resources_)
+	{
+		if (std::find(other.resources_.begin(), other.resources_.end(), resource) != other.resources_.end())
+		{
+			return true;
+		}
+	}
+
+	for (ComponentTypeID type : writes_)
+	{
+		if (std::find(other.reads_.begin(), other.reads_.end(), type) != other.reads_.end()
+			|| std::find(other.writes_.begin(), other.writes_.end(), type) != other.writes_.end())
+		{
+			return true;
+		}
+	}
+	for (ComponentTypeID type : other.writes_)
+	{
+		if (std::find(reads_.begin(), reads_.end(), type) != reads_.end())
+		{
+			return true;
+		}
+	}
+	return false;
+}
 
 // Protected Member Functions
 
 Junior::ComponentContainer::ComponentContainer()
+	: updateable_(true), stored_(false), typeID_(invalidComponentTypeID), owner_(nullptr), name_(), handle_(HandleTable::GetInstance().Register(this))
+{
+
+}
+
+Junior::ComponentContainer::ComponentContainer(const ComponentContainer& other)
+	: updateable_(other.updateable_), stored_(false), typeID_(other.typeID_), owner_(nullptr), name_(other.name_), handle_(HandleTable::GetInstance().Register(this))
 {
 
 }
@@ -23,6 +112,7 @@ Junior::ComponentContainer::ComponentContainer()
 
 Junior::ComponentContainer::~ComponentContainer()
 {
+	HandleTable::GetInstance().Release(handle_);
 }
 
 void Junior::ComponentContainer::SetOwner(GameObject* cog)
@@ -30,6 +120,11 @@ void Junior::ComponentContainer::SetOwner(GameObject* cog)
 	owner_ = cog;
 }
 
+Junior::GameObject* Junior::ComponentContainer::GetOwner() const
+{
+	return owner_;
+}
+
 void Junior::ComponentContainer::Serialize(Parser& parser) const
 {
 
@@ -45,7 +140,81 @@ const std::string Junior::ComponentContainer::GetTypeName() const
 	return name_;
 }
 
+Junior::ComponentTypeID Junior::ComponentContainer::GetTypeID() const
+{
+	return typeID_;
+}
+
 bool Junior::ComponentContainer::IsUpdateable() const
 {
 	return updateable_;
+}
+
+void Junior::ComponentContainer::SetUpdateable(bool updateable)
+{
+	if (updateable_ == updateable)
+	{
+		return;
+	}
+	updateable_ = updateable;
+	if (owner_)
+	{
+		owner_->RefreshUpdateLists();
+	}
+}
+
+bool Junior::ComponentContainer::HasUpdate() const
+{
+	return GetLayout().updateColumn_ != nullptr;
+}
+
+bool Junior::ComponentContainer::HasFixedUpdate() const
+{
+	return GetLayout().fixedUpdateColumn_ != nullptr;
+}
+
+void Junior::ComponentContainer::SetStored(bool stored)
+{
+	stored_ = stored;
+}
+
+bool Junior::ComponentContainer::IsStored() const
+{
+	return stored_;
+}
+
+Junior::HandleID Junior::ComponentContainer::GetHandle() const
+{
+	return handle_;
+}
+
+// Public Static Functions
+
+Junior::ComponentTypeID Junior::ComponentContainer::RegisterType(const std::string& name)
+{
+	// Most types are already registered, so look for them first without blocking other readers
+	ComponentTypeID id = FindTypeID(name);
+	if (id != invalidComponentTypeID)
+	{
+		return id;
+	}
+	std::unique_lock<std::shared_timed_mutex> lock(GetTypeRegistryMutex());
+	std::unordered_map<std::string, ComponentTypeID>& registry = GetTypeRegistry();
+	// Another thread may have registered the type between the two locks
+	auto found = registry.find(name);
+	if (found != registry.end())
+	{
+		return found->second;
+	}
+	id = static_cast<ComponentTypeID>(registry.size());
+	registry.insert(std::make_pair(name, id));
+	return id;
+}
+
+Junior::ComponentTypeID Junior::ComponentContainer::FindTypeID(const std::string& name)
+{
+	std::shared_lock<std::shared_timed_mutex> lock(GetTypeRegistryMutex());
+	std::unordered_map<std::string, ComponentTypeID>& registry = GetTypeRegistry();
+	auto found = registry.find(name);
+	return found != registry.end() ? found->second : invalidComponentTypeID;
 }
\ No newline at end of file
@@ -4,43 +4,174 @@
  * File name: DefaultMesh.cpp
  * Description: The default mesh that objects use when they don't specify a particular mesh
  * Created: 2 May 2019
- * Last Modified: 2 May 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include "DefaultMesh.h"
 #include "RenderJob.h"
+#include "CullingVolume.h"		// Culling Volume
+#include "Graphics.h"			// Main Camera
+#include "Camera.h"				// Camera Matrix
+#include "LinearMath.h"			// Identity
+#include <algorithm>			// Stable Sort
+#include <cstddef>				// Offset Of
+#include <cstring>				// Memory Copy
+#include <utility>				// Swap
 
-// Public Member Functions
+// Private Member Functions
 
-Junior::DefaultMesh::DefaultMesh()
-	: Mesh("DefaultMesh", Mesh::CreateQuadMeshData()), renderJobs_()
+void Junior::DefaultMesh::MarkDirty(size_t index)
 {
-	// The buffer for all render job data
-	glGenBuffers(1, &jobsBufferObject_);
-	StartBinding();
+	// Only the job's own byte is written, the draw finds the dirty jobs while going through the drawn ones
+	staleRegions_[index] = (1 << InstanceRingBuffer::NUM_REGIONS) - 1;
+}
 
-	// The buffer for all render job data
-	glBindBuffer(GL_ARRAY_BUFFER, jobsBufferObject_);
-	glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_STREAM_DRAW);
-	// Transformation Matrix
-	// We have four vectors per matrix, so we are setting one vector per time
-	for (unsigned matrixPart = 0; matrixPart < 4; ++matrixPart)
+void Junior::DefaultMesh::SwapJobs(size_t first, size_t second)
+{
+	// The regions hold whatever job used to be at both indices, this also covers a job being shown or hidden in place
+	MarkDirty(first);
+	MarkDirty(second);
+	if (first == second)
+	{
+		return;
+	}
+	std::swap(renderJobs_[first], renderJobs_[second]);
+	std::swap(jobSlots_[first], jobSlots_[second]);
+	slots_[jobSlots_[first]].index_ = first;
+	slots_[jobSlots_[second]].index_ = second;
+}
+
+bool Junior::DefaultMesh::FindJob(RenderJobHandle handle, size_t& index) const
+{
+	if (handle.generation_ == 0 || handle.slot_ >= slots_.size() || slots_[handle.slot_].generation_ != handle.generation_)
+	{
+		return false;
+	}
+	index = slots_[handle.slot_].index_;
+	return true;
+}
+
+void Junior::DefaultMesh::SortJobs()
+{
+	// Most frames no job changes its depth, so the jobs are only sorted when they are out of order
+	bool sorted = true;
+	for (size_t i = 1; i < visibleCount_ && sorted; ++i)
+	{
+		sorted = !(renderJobs_[i].depth_ < renderJobs_[i - 1].depth_);
+	}
+	if (sorted)
+	{
+		return;
+	}
+
+	// A stable sort keeps the jobs sharing a depth where they were, so fewer jobs move and have to be uploaded again
+	depthOrder_.resize(visibleCount_);
+	for (size_t i = 0; i < visibleCount_; ++i)
+	{
+		depthOrder_[i] = i;
+	}
+	const std::vector<RenderJob>& jobs = renderJobs_;
+	std::stable_sort(depthOrder_.begin(), depthOrder_.end(), [&jobs](size_t lhs, size_t rhs) { return jobs[lhs].depth_ < jobs[rhs].depth_; });
+
+	unsortedJobs_.assign(renderJobs_.begin(), renderJobs_.begin() + visibleCount_);
+	unsortedSlots_.assign(jobSlots_.begin(), jobSlots_.begin() + visibleCount_);
+	for (size_t i = 0; i < visibleCount_; ++i)
+	{
+		size_t from = depthOrder_[i];
+		if (from != i)
+		{
+			renderJobs_[i] = unsortedJobs_[from];
+			jobSlots_[i] = unsortedSlots_[from];
+			slots_[jobSlots_[i]].index_ = i;
+			MarkDirty(i);
+		}
+	}
+}
+
+void Junior::DefaultMesh::CullJobs()
+{
+	// Without a camera the shaders draw in clip space as it is
+	Camera* camera = Graphics::GetInstance().mainCamera_;
+	CullingVolume volume(camera ? camera->GetCameraMatrix() : Identity());
+
+	// A straight pass over the packed jobs without branching on the result, so it stays cheap for large levels
+	drawnJobs_.resize(visibleCount_);
+	size_t index = 0;
+#ifdef JUNIOR_MATH_SSE
+	// Four jobs at a time, the volume reads the depth straight after the transformation
+	static_assert(offsetof(RenderJob, depth_) == offsetof(RenderJob, transformation_) + sizeof(Affine2D), "The depth has to follow the transformation");
+	const unsigned char* jobs = reinterpret_cast<const unsigned char*>(renderJobs_.data()) + offsetof(RenderJob, transformation_);
+	for (; index + 4 <= visibleCount_; index += 4)
+	{
+		int visible = volume.AreQuadsVisible(jobs + sizeof(RenderJob) * index, sizeof(RenderJob));
+		drawnJobs_[index] = static_cast<unsigned char>(visible & 1);
+		drawnJobs_[index + 1] = static_cast<unsigned char>((visible >> 1) & 1);
+		drawnJobs_[index + 2] = static_cast<unsigned char>((visible >> 2) & 1);
+		drawnJobs_[index + 3] = static_cast<unsigned char>((visible >> 3) & 1);
+	}
+#endif
+	for (; index < visibleCount_; ++index)
 	{
-		int currentMatrixAttrib = Mesh::ATTRIBUTE_START_INDEX + matrixPart;
-		size_t currentOffset = sizeof(float) * matrixPart * 4;
-		glEnableVertexAttribArray(currentMatrixAttrib);
-		glVertexAttribPointer(currentMatrixAttrib, 4, GL_FLOAT, GL_FALSE,
-			sizeof(RenderJob), reinterpret_cast<void*>(currentOffset));
+		drawnJobs_[index] = static_cast<unsigned char>(volume.IsQuadVisible(renderJobs_[index].transformation_, renderJobs_[index].depth_));
 	}
 
+	// Short gaps are drawn anyway, since every gap splits the draw call in two
+	drawnCount_ = 0;
+	size_t lastDrawn = 0;
+	for (size_t i = 0; i < visibleCount_; ++i)
+	{
+		if (!drawnJobs_[i])
+		{
+			continue;
+		}
+		if (drawnCount_ > 0 && i - lastDrawn - 1 <= MAX_CULLING_GAP)
+		{
+			for (size_t gap = lastDrawn + 1; gap < i; ++gap)
+			{
+				drawnJobs_[gap] = 1;
+				++drawnCount_;
+			}
+		}
+		lastDrawn = i;
+		++drawnCount_;
+	}
+	culledCount_ = visibleCount_ - drawnCount_;
+}
+
+void Junior::DefaultMesh::PointAttributes(size_t offset)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer_.GetBufferObject());
+	// Transformation
+	// The two columns of the rotation and scaling go in one vector, the translation and depth in another
+	glVertexAttribPointer(Mesh::ATTRIBUTE_START_INDEX, 4, GL_FLOAT, GL_FALSE,
+		sizeof(RenderJob), reinterpret_cast<void*>(offset + offsetof(RenderJob, transformation_)));
+	glVertexAttribPointer(Mesh::ATTRIBUTE_START_INDEX + 1, 3, GL_FLOAT, GL_FALSE,
+		sizeof(RenderJob), reinterpret_cast<void*>(offset + offsetof(RenderJob, transformation_) + sizeof(float) * 4));
+
 	// UV Coordinate Modification Data
-	glEnableVertexAttribArray(Mesh::ATTRIBUTE_START_INDEX + 4);
-	glVertexAttribPointer(Mesh::ATTRIBUTE_START_INDEX + 4, 4, GL_FLOAT, GL_FALSE, sizeof(RenderJob), reinterpret_cast<void*>(sizeof(float) * 4 * 4));
+	// The translation is normalized, so the shader reads the 16 bit fractions back as floats between 0 and 1
+	glVertexAttribPointer(Mesh::ATTRIBUTE_START_INDEX + 2, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(RenderJob), reinterpret_cast<void*>(offset + offsetof(RenderJob, uvTranslation_)));
+	glVertexAttribPointer(Mesh::ATTRIBUTE_START_INDEX + 3, 2, GL_FLOAT, GL_FALSE, sizeof(RenderJob), reinterpret_cast<void*>(offset + offsetof(RenderJob, uvScale_)));
 
 	// Texture Selection Data
-	glEnableVertexAttribArray(Mesh::ATTRIBUTE_START_INDEX + 5);
-	glVertexAttribPointer(Mesh::ATTRIBUTE_START_INDEX + 5, 1, GL_UNSIGNED_INT, GL_FALSE, sizeof(RenderJob), reinterpret_cast<void*>(sizeof(float) * 5 * 4));
+	glVertexAttribPointer(Mesh::ATTRIBUTE_START_INDEX + 4, 1, GL_UNSIGNED_INT, GL_FALSE, sizeof(RenderJob), reinterpret_cast<void*>(offset + offsetof(RenderJob, textureID_)));
+}
+
+// Public Member Functions
+
+Junior::DefaultMesh::DefaultMesh()
+	: Mesh("DefaultMesh", Mesh::CreateQuadMeshData()), instanceBuffer_(sizeof(RenderJob) * 1024), renderJobs_(), jobSlots_(), staleRegions_(), slots_(), freeSlots_(), visibleCount_(0),
+	drawnJobs_(), depthOrder_(), unsortedJobs_(), unsortedSlots_(), drawnCount_(0), culledCount_(0), bytesUploaded_(0), bytesSaved_(0), fenceStalls_(0)
+{
+	StartBinding();
+
+	// The buffer for all render job data
+	for (unsigned i = 0; i <= NUM_ATTRIBUTES; ++i)
+	{
+		glEnableVertexAttribArray(Mesh::ATTRIBUTE_START_INDEX + i);
+	}
+	PointAttributes(0);
 
 	// Set the attribute divisors
 	for (unsigned i = 0; i <= NUM_ATTRIBUTES; ++i)
@@ -56,25 +187,76 @@ Junior::DefaultMesh::~DefaultMesh()
 {
 	DeleteBufferData();
 	ClearJobs();
-	glDeleteBuffers(1, &jobsBufferObject_);
 }
 
 
 void Junior::DefaultMesh::Draw(unsigned)
 {
-	// Fill in the render job data
-	// Fill the data
-	size_t renderJobSize = sizeof(RenderJob) * renderJobs_.size();
-	readyToRenderJobs_.clear();
-	readyToRenderJobs_.reserve(renderJobs_.size());
-	for (size_t i = 0; i < renderJobs_.size(); ++i)
+	bytesUploaded_ = 0;
+	bytesSaved_ = 0;
+	fenceStalls_ = 0;
+	drawnCount_ = 0;
+	culledCount_ = 0;
+	if (visibleCount_ == 0)
+	{
+		return;
+	}
+
+	// The visible jobs are drawn in one instanced call per run, so they are put in depth order first
+	SortJobs();
+	// Nothing is written or drawn for the jobs off screen
+	CullJobs();
+	if (drawnCount_ == 0)
 	{
-		readyToRenderJobs_.push_back(*renderJobs_[i]);
+		return;
 	}
 
-	glBindBuffer(GL_ARRAY_BUFFER, jobsBufferObject_);
-	glBufferData(GL_ARRAY_BUFFER, renderJobSize, nullptr, GL_STREAM_DRAW);
-	glBufferSubData(GL_ARRAY_BUFFER, 0, renderJobSize, readyToRenderJobs_.data());
+	// The region still holds the jobs as they were three draws ago, so only the jobs that changed since then are written
+	size_t size = sizeof(RenderJob) * visibleCount_;
+	if (instanceBuffer_.BeginWrite(size))
+	{
+		// The buffer grew and lost every region
+		for (size_t i = 0; i < renderJobs_.size(); ++i)
+		{
+			MarkDirty(i);
+		}
+	}
+	unsigned char regionBit = static_cast<unsigned char>(1 << instanceBuffer_.GetCurrentRegion());
+
+	// Going through the drawn jobs in order lets neighbouring dirty jobs be written as a single range
+	// Culled jobs keep their stale regions until they come back on screen, hidden jobs are marked again when they are shown
+	size_t rangeStart = 0;
+	size_t rangeEnd = 0;
+	for (size_t index = 0; index < visibleCount_; ++index)
+	{
+		if (drawnJobs_[index] && (staleRegions_[index] & regionBit))
+		{
+			// The job stays dirty until every region has been given its new data
+			staleRegions_[index] &= ~regionBit;
+			if (index != rangeEnd || rangeStart == rangeEnd)
+			{
+				if (rangeStart != rangeEnd)
+				{
+					instanceBuffer_.WriteRange(sizeof(RenderJob) * rangeStart, &renderJobs_[rangeStart], sizeof(RenderJob) * (rangeEnd - rangeStart));
+				}
+				rangeStart = index;
+			}
+			rangeEnd = index + 1;
+		}
+	}
+	if (rangeStart != rangeEnd)
+	{
+		instanceBuffer_.WriteRange(sizeof(RenderJob) * rangeStart, &renderJobs_[rangeStart], sizeof(RenderJob) * (rangeEnd - rangeStart));
+	}
+
+	size_t offset = instanceBuffer_.EndWrite();
+	bytesUploaded_ = instanceBuffer_.GetBytesUploaded();
+	// Only the drawn jobs could have been written, the culled ones are not savings of the dirty ranges
+	bytesSaved_ = sizeof(RenderJob) * drawnCount_ - bytesUploaded_;
+	fenceStalls_ = instanceBuffer_.GetFenceStallCount();
+
+	// The attributes point at the region written this frame
+	PointAttributes(offset);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 
 	// Enable all of the attributes
@@ -85,8 +267,37 @@ void Junior::DefaultMesh::Draw(unsigned)
 		glEnableVertexAttribArray(i + Mesh::ATTRIBUTE_START_INDEX);
 	}
 
-	// Draw all of the objects sharing this mesh
-	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(renderJobs_.size()));
+	// Draw every run of jobs on screen, starting the instances at the run when the driver can, or pointing the attributes at it otherwise
+	bool baseInstance = GLEW_VERSION_4_2 || GLEW_ARB_base_instance;
+	size_t runStart = 0;
+	while (runStart < visibleCount_)
+	{
+		if (!drawnJobs_[runStart])
+		{
+			++runStart;
+			continue;
+		}
+		size_t runEnd = runStart + 1;
+		while (runEnd < visibleCount_ && drawnJobs_[runEnd])
+		{
+			++runEnd;
+		}
+
+		GLsizei count = static_cast<GLsizei>(runEnd - runStart);
+		if (baseInstance)
+		{
+			glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4, count, static_cast<GLuint>(runStart));
+		}
+		else
+		{
+			PointAttributes(offset + sizeof(RenderJob) * runStart);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
+		}
+		runStart = runEnd;
+	}
+	// The region stays untouched until the GPU is done drawing from it
+	instanceBuffer_.Fence();
 
 	// Disable all of the attributes
 	SetBasicVertexAttribsEnabled(false);
@@ -98,35 +309,149 @@ void Junior::DefaultMesh::Draw(unsigned)
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-Junior::RenderJob* Junior::DefaultMesh::GetNewRenderJob()
+Junior::RenderJobHandle Junior::DefaultMesh::CreateRenderJob()
+{
+	// Reuse a free slot when there is one, its generation already tells it apart from the handles made before
+	unsigned slot;
+	if (!freeSlots_.empty())
+	{
+		slot = freeSlots_.back();
+		freeSlots_.pop_back();
+	}
+	else
+	{
+		slot = static_cast<unsigned>(slots_.size());
+		JobSlot newSlot = { 0, 1 };
+		slots_.push_back(newSlot);
+	}
+
+	// The job goes at the end and is swapped with the first hidden job, so it joins the visible ones
+	slots_[slot].index_ = renderJobs_.size();
+	renderJobs_.push_back(RenderJob());
+	jobSlots_.push_back(slot);
+	staleRegions_.push_back(0);
+	SwapJobs(slots_[slot].index_, visibleCount_);
+	++visibleCount_;
+
+	RenderJobHandle handle;
+	handle.slot_ = slot;
+	handle.generation_ = slots_[slot].generation_;
+	return handle;
+}
+
+const Junior::RenderJob* Junior::DefaultMesh::GetRenderJob(RenderJobHandle handle) const
 {
-	RenderJob* renderJob = new RenderJob;
-	renderJobs_.push_back(renderJob);
-	return renderJob;
+	size_t index;
+	return FindJob(handle, index) ? &renderJobs_[index] : nullptr;
 }
 
-void Junior::DefaultMesh::RemoveRenderJob(const RenderJob* renderJob)
+void Junior::DefaultMesh::SetRenderJob(RenderJobHandle handle, const RenderJob& job)
 {
-	if (!renderJob)
+	size_t index;
+	if (!FindJob(handle, index))
+	{
 		return;
+	}
 
-	for (auto iter = renderJobs_.cbegin(); iter != renderJobs_.cend(); ++iter)
+	// Render jobs have no padding, so comparing their bytes is enough to tell whether anything changed
+	if (std::memcmp(&renderJobs_[index], &job, sizeof(RenderJob)) != 0)
 	{
-		if ((*iter) == renderJob)
-		{
-			renderJobs_.erase(iter);
-			return;
-		}
+		renderJobs_[index] = job;
+		MarkDirty(index);
 	}
 }
 
-void Junior::DefaultMesh::ClearJobs()
+void Junior::DefaultMesh::SetRenderJobVisible(RenderJobHandle handle, bool visible)
 {
-	// Delete all of the render jobs we have allocated
-	for (auto iter = renderJobs_.cbegin(); iter != renderJobs_.cend(); ++iter)
+	size_t index;
+	if (!FindJob(handle, index))
 	{
-		delete (*iter);
+		return;
 	}
 
+	// The visible jobs sit in front of the hidden ones, so a job only has to trade places with the job at the border
+	if (visible && index >= visibleCount_)
+	{
+		SwapJobs(index, visibleCount_);
+		++visibleCount_;
+	}
+	else if (!visible && index < visibleCount_)
+	{
+		--visibleCount_;
+		SwapJobs(index, visibleCount_);
+	}
+}
+
+void Junior::DefaultMesh::ReleaseRenderJob(RenderJobHandle handle)
+{
+	size_t index;
+	if (!FindJob(handle, index))
+	{
+		return;
+	}
+
+	// Hide the job first, then swap it with the last job and drop it
+	SetRenderJobVisible(handle, false);
+	index = slots_[handle.slot_].index_;
+	SwapJobs(index, renderJobs_.size() - 1);
+	renderJobs_.pop_back();
+	jobSlots_.pop_back();
+	staleRegions_.pop_back();
+
+	// Zero stays reserved for null handles
+	JobSlot& slot = slots_[handle.slot_];
+	++slot.generation_;
+	if (slot.generation_ == 0)
+	{
+		slot.generation_ = 1;
+	}
+	freeSlots_.push_back(handle.slot_);
+}
+
+void Junior::DefaultMesh::ClearJobs()
+{
+	// Every slot that pointed at a job is released, so the handles to them stop resolving
+	for (unsigned slot : jobSlots_)
+	{
+		++slots_[slot].generation_;
+		if (slots_[slot].generation_ == 0)
+		{
+			slots_[slot].generation_ = 1;
+		}
+		freeSlots_.push_back(slot);
+	}
 	renderJobs_.clear();
+	jobSlots_.clear();
+	staleRegions_.clear();
+	visibleCount_ = 0;
+}
+
+size_t Junior::DefaultMesh::GetVisibleJobCount() const
+{
+	return visibleCount_;
+}
+
+size_t Junior::DefaultMesh::GetDrawnJobCount() const
+{
+	return drawnCount_;
+}
+
+size_t Junior::DefaultMesh::GetCulledJobCount() const
+{
+	return culledCount_;
+}
+
+size_t Junior::DefaultMesh::GetBytesUploaded() const
+{
+	return bytesUploaded_;
+}
+
+size_t Junior::DefaultMesh::GetBytesSaved() const
+{
+	return bytesSaved_;
+}
+
+unsigned Junior::DefaultMesh::GetFenceStallCount() const
+{
+	return fenceStalls_;
 }
\ No newline at end of file
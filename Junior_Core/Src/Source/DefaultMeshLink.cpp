@@ -4,7 +4,7 @@
 * File name: DefaultMeshLink.cpp
 * Description: Links this game object to the DefaultMesh to render it on screen
 * Created: 4 May 2018
-* Last Modified: 4 May 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -14,26 +14,29 @@
 #include "GameObject.h"			// Game Object
 #include "Transform.h"			// Transform
 #include "Sprite.h"				// Sprite
+#include "GameObjectManager.h"	// Game Object Manager
 
 // Public Member Functions
 
 Junior::DefaultMeshLink::DefaultMeshLink(bool loadMeshData)
-	: defaultProgramDir("..//Assets//Shaders//starter"), renderJob_(nullptr), sprite_(nullptr)
+	: defaultProgramDir("..//Assets//Shaders//starter"), mesh_(nullptr), renderJob_(), sprite_(nullptr)
 {
 	// Get a new render job
 	if (loadMeshData)
 	{
 		Graphics& graphics = Graphics::GetInstance();
-		renderJob_ = graphics.GetMesh<DefaultMesh>(defaultProgramDir)->GetNewRenderJob();
+		mesh_ = graphics.GetMesh<DefaultMesh>(defaultProgramDir);
+		renderJob_ = mesh_->CreateRenderJob();
 	}
 }
 
 Junior::DefaultMeshLink::DefaultMeshLink(const DefaultMeshLink& other)
-	: defaultProgramDir("..//Assets//Shaders//starter"), renderJob_(nullptr), transform_(nullptr), sprite_(nullptr)
+	: defaultProgramDir("..//Assets//Shaders//starter"), mesh_(nullptr), renderJob_(), transform_(nullptr), sprite_(nullptr)
 {
 	// Get a new render job
 	Graphics& graphics = Graphics::GetInstance();
-	renderJob_ = graphics.GetMesh<DefaultMesh>(defaultProgramDir)->GetNewRenderJob();
+	mesh_ = graphics.GetMesh<DefaultMesh>(defaultProgramDir);
+	renderJob_ = mesh_->CreateRenderJob();
 }
 
 void Junior::DefaultMeshLink::Initialize()
@@ -45,26 +48,64 @@ void Junior::DefaultMeshLink::Initialize()
 
 void Junior::DefaultMeshLink::Update(double)
 {
-	// Update the transform if it exists
+	// The mesh keeps its render jobs packed together, so the job is looked up again every frame
+	const RenderJob* current = mesh_ ? mesh_->GetRenderJob(renderJob_) : nullptr;
+	if (!current)
+	{
+		return;
+	}
+	RenderJob renderJob = *current;
+
+	// Update the transform if it exists, blending it between the last two fixed updates so movement stays smooth at any fixed rate
 	if (transform_)
 	{
-		renderJob_->transformation_ = transform_->GetGlobalTransformation();
+		float alpha = GameObjectManager::GetInstance().GetInterpolationAlpha();
+		renderJob.transformation_ = transform_->GetInterpolatedAffine(alpha);
+		renderJob.depth_ = transform_->GetInterpolatedDepth(alpha);
 	}
 	// Update the sprite if it exists
 	if (sprite_)
 	{
 		Vec3 atlasOffset = sprite_->GetAtlasOffset();
 		Vec3 atlasScale = sprite_->GetAtlasScale();
-		renderJob_->uvTranslationAndScale_ = Vec3(atlasOffset.x_, atlasOffset.y_, atlasScale.x_, atlasScale.y_);
+		renderJob.SetUVTranslationAndScale(Vec3(atlasOffset.x_, atlasOffset.y_, atlasScale.x_, atlasScale.y_));
 	}
+	// The mesh only uploads the job again when it changed, so objects that stand still cost nothing to draw
+	mesh_->SetRenderJob(renderJob_, renderJob);
 }
 
 void Junior::DefaultMeshLink::Unload()
 {
-	if (renderJob_)
+	if (mesh_)
 	{
-		Graphics& graphics = Graphics::GetInstance();
-		graphics.GetMesh<DefaultMesh>(defaultProgramDir)->RemoveRenderJob(renderJob_);
-		delete renderJob_;
+		mesh_->ReleaseRenderJob(renderJob_);
+		mesh_ = nullptr;
+	}
+}
+
+void Junior::DefaultMeshLink::Sleep()
+{
+	if (mesh_)
+	{
+		mesh_->SetRenderJobVisible(renderJob_, false);
 	}
+}
+
+void Junior::DefaultMeshLink::Wake()
+{
+	if (mesh_)
+	{
+		mesh_->SetRenderJobVisible(renderJob_, true);
+	}
+}
+
+// Public Static Functions
+
+void Junior::DefaultMeshLink::DeclareAccess(ComponentAccess& access)
+{
+	// Reading the world transformation rebuilds it when it is dirty, so the transform is written as well
+	access.Reads<Sprite>();
+	access.Writes<Transform>();
+	// Every link writes its render job into the same mesh, so other types writing the mesh never update alongside the links
+	access.WritesResource<DefaultMesh>();
 }
\ No newline at end of file
@@ -3,7 +3,7 @@
  * Email: david.wongcascante@digipen.edu
  * File name: DrawProgram.cpp
  * Date CreateDd: 26 Apr 2018
- * Last Modified: 6 May 2019
+ * Last Modified: 17 Oct 2026
  * Description: Write the definition for the shade functionality, especially for the functions that create and destroy said program
 */
 
@@ -16,6 +16,7 @@
 #include <string>			// String functionality
 #include "Debug.h"			// Debug Info
 #include "Mesh.h"			// Mesh
+#include "RenderQueue.h"	// Render Queue
 
 // Private Member Functions //
 int Junior::DrawProgram::CreateShader(int* id, int type, const char** source)
@@ -182,14 +183,12 @@ void Junior::DrawProgram::LoadFromDisk(const std::string& fileDir)
 	// return 1;
 }
 
-void Junior::DrawProgram::Draw()
+void Junior::DrawProgram::Submit(RenderQueue& queue, unsigned order)
 {
-	// Draw every mesh
+	queue.BeginProgram(this, order);
 	for (auto iter = meshes_.begin(); iter != meshes_.end(); ++iter)
 	{
-		(*iter)->StartBinding();
-		(*iter)->Draw(programID_);
-		(*iter)->EndBinding();
+		(*iter)->Submit(queue);
 	}
 }
 
@@ -5,7 +5,7 @@
 * File name: GameObject.h
 * Description: Define the Game Object functionality to get components, get its name, update, etc...
 * Created: 1 May 2018
-* Last Modified: 10 Sep 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes //
@@ -16,17 +16,103 @@
 #include "Graphics.h"			// Graphics
 #include "GameObjectFactory.h"	// Game Object Factory
 #include "Debug.h"				// Debug
+#include "ArchetypeStorage.h"	// Archetype Storage
+#include "Transform.h"			// Transform
+#include "GameObjectManager.h"	// Game Object Manager
+#include <unordered_map>		// Unordered Map
+#include <mutex>				// Mutex
+
+namespace
+{
+	// The identifiers of every interned name, keyed by the name
+	std::unordered_map<std::string, Junior::NameID>& GetNameRegistry()
+	{
+		static std::unordered_map<std::string, Junior::NameID> registry;
+		return registry;
+	}
+
+	// Guards the registry, since objects may be created from the job system's workers
+	std::mutex& GetNameRegistryMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+}
+
+// Private Member Functions //
+
+void Junior::GameObject::IndexComponent(ComponentContainer* component)
+{
+	ComponentTypeID id = component->GetTypeID();
+	if (id >= maxIndexedTypes_)
+	{
+		return;
+	}
+
+	// Only the first component of every type is indexed
+	unsigned long long bit = 1ull << id;
+	if (signature_ & bit)
+	{
+		return;
+	}
+	indexed_.insert(indexed_.begin() + CountBits(signature_ & (bit - 1)), component);
+	signature_ |= bit;
+}
+
+void Junior::GameObject::UnindexComponent(ComponentContainer* component)
+{
+	ComponentTypeID id = component->GetTypeID();
+	if (id >= maxIndexedTypes_)
+	{
+		return;
+	}
+
+	unsigned long long bit = 1ull << id;
+	unsigned index = CountBits(signature_ & (bit - 1));
+	if (!(signature_ & bit) || indexed_[index] != component)
+	{
+		return;
+	}
+	indexed_.erase(indexed_.begin() + index);
+	signature_ &= ~bit;
+
+	// If there is another component of the same type, then it takes over the slot
+	for (ComponentContainer* other : components_)
+	{
+		if (other->GetTypeID() == id)
+		{
+			IndexComponent(other);
+			return;
+		}
+	}
+}
+
+Junior::ComponentContainer* Junior::GameObject::FindUnindexed(ComponentTypeID id) const
+{
+	for (ComponentContainer* component : components_)
+	{
+		if (component->GetTypeID() == id)
+		{
+			return component;
+		}
+	}
+	return nullptr;
+}
 
 // Public Member Functions //
 
 Junior::GameObject::GameObject(const std::string& name, bool isArchetype)
-	: name_(name), components_(), children_(), parent_(nullptr), destroyed_(false), isArchetype_(isArchetype)
+	: name_(name), nameID_(InternName(name)), components_(), children_(), parent_(nullptr), destroyed_(false), isArchetype_(isArchetype), archetype_(nullptr), archetypeRow_(0), storedComponents_(0), signature_(0), indexed_(),
+	managerIndex_(unmanagedIndex_), handle_(HandleTable::GetInstance().Register(this)), nameSlot_(0),
+	updating_(), fixedUpdating_(), sleeping_(false), alwaysLoaded_(false), updateSlot_(unmanagedIndex_), fixedUpdateSlot_(unmanagedIndex_)
 {
 	Graphics& graphics = Graphics::GetInstance();
 }
 
 Junior::GameObject::GameObject(const GameObject& other)
-	: name_(other.name_), parent_(other.parent_), destroyed_(false), isArchetype_(false)
+	: name_(other.name_), nameID_(other.nameID_), parent_(other.parent_), destroyed_(false), isArchetype_(false), archetype_(nullptr), archetypeRow_(0), storedComponents_(0), signature_(0), indexed_(),
+	managerIndex_(unmanagedIndex_), handle_(HandleTable::GetInstance().Register(this)), nameSlot_(0),
+	updating_(), fixedUpdating_(), sleeping_(false), alwaysLoaded_(false), updateSlot_(unmanagedIndex_), fixedUpdateSlot_(unmanagedIndex_)
 {
 	Graphics& graphics = Graphics::GetInstance();
 	// Create a render job if the other did have one
@@ -36,7 +122,30 @@ Junior::GameObject::GameObject(const GameObject& other)
 		ComponentContainer* container = (*componentsBegin)->Clone();
 		container->SetOwner(this);
 		components_.push_back(container);
+		IndexComponent(container);
+	}
+	RefreshUpdateLists();
+	// Then copy its children
+	for (auto childrenBegin = other.children_.cbegin(); childrenBegin != other.children_.cend(); ++childrenBegin)
+	{
+		GameObject* other = new GameObject(**childrenBegin);
+		children_.push_back(other);
+	}
+}
+
+Junior::GameObject::GameObject(const GameObject& other, ArchetypeStorage& storage)
+	: name_(other.name_), nameID_(other.nameID_), parent_(other.parent_), destroyed_(false), isArchetype_(false), archetype_(&storage), archetypeRow_(0), storedComponents_(0), signature_(0), indexed_(),
+	managerIndex_(unmanagedIndex_), handle_(HandleTable::GetInstance().Register(this)), nameSlot_(0),
+	updating_(), fixedUpdating_(), sleeping_(false), alwaysLoaded_(false), updateSlot_(unmanagedIndex_), fixedUpdateSlot_(unmanagedIndex_)
+{
+	// Copy the components straight into the storage's columns
+	archetypeRow_ = storage.Insert(this, other.components_, components_);
+	storedComponents_ = components_.size();
+	for (ComponentContainer* component : components_)
+	{
+		IndexComponent(component);
 	}
+	RefreshUpdateLists();
 	// Then copy its children
 	for (auto childrenBegin = other.children_.cbegin(); childrenBegin != other.children_.cend(); ++childrenBegin)
 	{
@@ -47,6 +156,8 @@ Junior::GameObject::GameObject(const GameObject& other)
 
 Junior::GameObject::~GameObject()
 {
+	// Handles to the object stop resolving before anything is torn down
+	HandleTable::GetInstance().Release(handle_);
 	Destroy();
 }
 
@@ -59,30 +170,18 @@ void Junior::GameObject::Initialize()
 }
 void Junior::GameObject::Update(double ms)
 {
-	if (components_.size() > 0)
+	// Only the components that define Update are listed, components inside archetype storage are updated by the storage
+	for (size_t i = 0; i < updating_.size(); ++i)
 	{
-		for (ComponentContainer* component : components_)
-		{
-			// Update all the objects, and ignore all the objects that are not marked for updating
-			if (component->IsUpdateable())
-			{
-				component->Update(ms);
-			}
-		}
+		updating_[i]->Update(ms);
 	}
 }
 
 void Junior::GameObject::FixedUpdate(double dt)
 {
-	if (components_.size() > 0)
+	for (size_t i = 0; i < fixedUpdating_.size(); ++i)
 	{
-		for (ComponentContainer* component : components_)
-		{
-			if (component->IsUpdateable())
-			{
-				component->FixedUpdate(dt);
-			}
-		}
+		fixedUpdating_[i]->FixedUpdate(dt);
 	}
 }
 
@@ -90,6 +189,12 @@ void Junior::GameObject::AddChild(GameObject* child)
 {
 	child->parent_ = this;
 	children_.push_back(child);
+	// The child's world transformation now depends on this object
+	Transform* transform = child->GetComponent<Transform>();
+	if (transform)
+	{
+		transform->OnParentChanged();
+	}
 }
 
 void Junior::GameObject::Shutdown()
@@ -117,12 +222,26 @@ void Junior::GameObject::Unload()
 			if (component)
 			{
 				component->Unload();
-				//manager->DeAllocate(component);
-				delete component;
+				// The storage owns the memory of the stored components, and destroys them when the row is released
+				if (!component->IsStored())
+				{
+					//manager->DeAllocate(component);
+					delete component;
+				}
 				component = 0;
 			}
 		}
 	}
+
+	if (archetype_)
+	{
+		archetype_->Release(archetypeRow_);
+		archetype_ = nullptr;
+		storedComponents_ = 0;
+	}
+	components_.clear();
+	indexed_.clear();
+	signature_ = 0;
 }
 
 // Add the component to the game object
@@ -131,18 +250,39 @@ void Junior::GameObject::AddComponent(ComponentContainer* component)
 	component->SetOwner(this);
 	component->Initialize();
 	components_.push_back(component);
+	unsigned long long oldSignature = signature_;
+	IndexComponent(component);
+	GameObjectManager::GetInstance().ChangeSignature(this, oldSignature);
+	RefreshUpdateLists();
 }
 
 // Removes the component from the game object
 void Junior::GameObject::RemoveComponent(const std::string& type)
 {
+	ComponentTypeID id = ComponentContainer::FindTypeID(type);
+	if (id == invalidComponentTypeID)
+	{
+		return;
+	}
+
 	// Iterate through the list of components until we find the component we are looking for
 	for (unsigned i = 0; i < components_.size(); ++i)
 	{
-		if (components_[i]->GetTypeName() == type)
+		if (components_[i]->GetTypeID() == id)
 		{	
+			// Stored components stay alive until the row is released, they just stop being updated
+			if (components_[i]->IsStored())
+			{
+				archetype_->Detach(archetypeRow_, components_[i]);
+				--storedComponents_;
+			}
 			// Remove the first component with the type
+			ComponentContainer* component = components_[i];
 			components_.erase(components_.begin() + i);
+			unsigned long long oldSignature = signature_;
+			UnindexComponent(component);
+			GameObjectManager::GetInstance().ChangeSignature(this, oldSignature);
+			RefreshUpdateLists();
 			return;
 		}
 	}
@@ -205,15 +345,37 @@ void Junior::GameObject::Deserialize(Parser& parser)
 // Set the object's name
 void Junior::GameObject::SetName(const std::string& name)
 {
+	NameID oldID = nameID_;
 	name_ = name;
+	nameID_ = InternName(name);
+
+	// Keep the manager's name lookups pointing at the new name
+	if (managerIndex_ != unmanagedIndex_)
+	{
+		GameObjectManager::GetInstance().RenameObject(this, oldID);
+	}
+	else if (isArchetype_)
+	{
+		GameObjectManager::GetInstance().RenameArchetype(this, oldID);
+	}
 }
 
 // Get the objects's name
-std::string Junior::GameObject::GetName() const
+const std::string& Junior::GameObject::GetName() const
 {
 	return name_;
 }
 
+Junior::NameID Junior::GameObject::GetNameID() const
+{
+	return nameID_;
+}
+
+Junior::HandleID Junior::GameObject::GetHandle() const
+{
+	return handle_;
+}
+
 // Get's the object's parent
 Junior::GameObject* Junior::GameObject::GetParent() const
 {
@@ -226,22 +388,36 @@ const std::vector<Junior::GameObject*>& Junior::GameObject::GetChildren() const
 	return children_;
 }
 
-// Get the first component it finds based on on the component's id
+// Gets the object's components
+const std::vector<Junior::ComponentContainer*>& Junior::GameObject::GetComponents() const
+{
+	return components_;
+}
+
+// Get the first component it finds based on on the component's type name
 Junior::ComponentContainer * Junior::GameObject::GetComponent(const std::string& type) const
 {
-	for (ComponentContainer* component : components_)
+	ComponentTypeID id = ComponentContainer::FindTypeID(type);
+	if (id == invalidComponentTypeID)
 	{
-		if (component->GetTypeName() == type)
-		{
-			return component;
-		}
+		return nullptr;
 	}
-	return nullptr;
+	return GetComponent(id);
 }
 
 void Junior::GameObject::Destroy()
 {
+	// The manager cleans the object up at the end of the frame
+	if (!destroyed_ && managerIndex_ != unmanagedIndex_)
+	{
+		GameObjectManager::GetInstance().QueueDestroy(this);
+	}
 	destroyed_ = true;
+	// Stop the storage from updating the components of a destroyed object
+	if (archetype_)
+	{
+		archetype_->Deactivate(archetypeRow_);
+	}
 
 	// Destroy all the children objects as well
 	for (GameObject* child : children_)
@@ -258,4 +434,154 @@ bool Junior::GameObject::IsDestroyed()
 bool Junior::GameObject::IsArchetype()
 {
 	return isArchetype_;
+}
+
+void Junior::GameObject::RefreshUpdateLists()
+{
+	updating_.clear();
+	fixedUpdating_.clear();
+	for (ComponentContainer* component : components_)
+	{
+		if (component->IsStored() || !component->IsUpdateable())
+		{
+			continue;
+		}
+		if (component->HasUpdate())
+		{
+			updating_.push_back(component);
+		}
+		if (component->HasFixedUpdate())
+		{
+			fixedUpdating_.push_back(component);
+		}
+	}
+
+	if (managerIndex_ != unmanagedIndex_)
+	{
+		GameObjectManager::GetInstance().RefreshUpdating(this);
+	}
+}
+
+const std::vector<Junior::ComponentContainer*>& Junior::GameObject::GetUpdatingComponents() const
+{
+	return updating_;
+}
+
+const std::vector<Junior::ComponentContainer*>& Junior::GameObject::GetFixedUpdatingComponents() const
+{
+	return fixedUpdating_;
+}
+
+void Junior::GameObject::SetSleeping(bool sleeping)
+{
+	if (sleeping_ == sleeping || destroyed_)
+	{
+		return;
+	}
+	sleeping_ = sleeping;
+	for (ComponentContainer* component : components_)
+	{
+		if (sleeping)
+		{
+			component->Sleep();
+		}
+		else
+		{
+			component->Wake();
+		}
+	}
+
+	// The stored components are switched off in their columns
+	if (archetype_)
+	{
+		if (sleeping)
+		{
+			archetype_->Deactivate(archetypeRow_);
+		}
+		else
+		{
+			archetype_->Activate(archetypeRow_, components_);
+		}
+	}
+	if (managerIndex_ != unmanagedIndex_)
+	{
+		GameObjectManager::GetInstance().RefreshUpdating(this);
+	}
+}
+
+bool Junior::GameObject::IsSleeping() const
+{
+	return sleeping_;
+}
+
+void Junior::GameObject::SetAlwaysLoaded(bool alwaysLoaded)
+{
+	alwaysLoaded_ = alwaysLoaded;
+}
+
+bool Junior::GameObject::IsAlwaysLoaded() const
+{
+	return alwaysLoaded_;
+}
+
+// Public Static Functions
+
+void* Junior::GameObject::operator new(size_t size)
+{
+	// Types deriving from the game object do not fit in the pool's blocks
+	if (size != sizeof(GameObject))
+	{
+		return ::operator new(size);
+	}
+	return GetPool().Allocate();
+}
+
+void Junior::GameObject::operator delete(void* memory, size_t size)
+{
+	if (size != sizeof(GameObject))
+	{
+		::operator delete(memory);
+		return;
+	}
+	GetPool().Free(memory);
+}
+
+#ifdef _DEBUG
+void* Junior::GameObject::operator new(size_t size, int, const char*, int)
+{
+	return operator new(size);
+}
+
+void Junior::GameObject::operator delete(void* memory, int, const char*, int)
+{
+	operator delete(memory, sizeof(GameObject));
+}
+#endif
+
+Junior::PoolAllocator& Junior::GameObject::GetPool()
+{
+	static PoolAllocator pool(sizeof(GameObject), alignof(GameObject), 256);
+	return pool;
+}
+
+Junior::NameID Junior::GameObject::InternName(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(GetNameRegistryMutex());
+	std::unordered_map<std::string, NameID>& registry = GetNameRegistry();
+	auto found = registry.find(name);
+	if (found != registry.end())
+	{
+		return found->second;
+	}
+	NameID id = static_cast<NameID>(registry.size());
+	registry.insert(std::make_pair(name, id));
+	return id;
+}
+
+Junior::NameID Junior::GameObject::FindNameID(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(GetNameRegistryMutex());
+	std::unordered_map<std::string, NameID>& registry = GetNameRegistry();
+	auto found = registry.find(name);
+	return found != registry.end() ? found->second : invalidNameID;
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
 * File name: GameObjectFactory.cpp
 * Description: Constructs game objects and components from files
 * Created: 9 Apr 2019
-* Last Modified: 3 Sep 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -14,6 +14,9 @@
 #include "GameObject.h"					// Game Object
 #include "Level.h"						// Level
 #include "Debug.h"						// Debug
+#include "LevelStreamer.h"				// Level Streamer
+#include <map>							// Map
+#include <cmath>						// Floor
 // Includes for all the standard components
 #include "Transform.h"
 #include "Sprite.h"
@@ -30,7 +33,7 @@
 // Private Member Functions
 
 Junior::GameObjectFactory::GameObjectFactory()
-	: filePath_("..//Assets//Objects//"), objectFileExtension_(".juo"), levelFileExtenion_(".jlv")
+	: filePath_("..//Assets//Objects//"), objectFileExtension_(".juo"), levelFileExtenion_(".jlv"), cellFileExtension_(".jlc"), cellIndexExtension_(".jls")
 {
 	preparedComponents_.reserve(NUM_STANDARD_COMPONENTS);
 	RegisterComponent<Transform>();
@@ -57,11 +60,17 @@ Junior::GameObjectFactory::~GameObjectFactory()
 
 Junior::ComponentContainer* Junior::GameObjectFactory::CreateComponent(const std::string& name) const
 {
-	// Traverse the entirety of the prepared components list and find the one with the correct name
+	// Look the name up once, then compare type identifiers instead of names
+	ComponentTypeID id = ComponentContainer::FindTypeID(name);
+	if (id == invalidComponentTypeID)
+	{
+		return nullptr;
+	}
+	// Traverse the entirety of the prepared components list and find the one with the correct type
 	for (auto cbegin = preparedComponents_.cbegin(); cbegin < preparedComponents_.cend(); ++cbegin)
 	{
 		// If we found the component we were looking for, then we need to clone it and return it
-		if ((*cbegin)->GetTypeName() == name)
+		if ((*cbegin)->GetTypeID() == id)
 		{
 			return (*cbegin)->Clone();
 		}
@@ -167,21 +176,14 @@ void Junior::GameObjectFactory::FillLevel(const std::string& levelName) const
 		for (unsigned i = 0; i < numObjects; ++i)
 		{
 			// Start reading objects
-			// Read the name of the game object
-			parser.ReadValue(name);
-			// If the name starts with a #, then we attempt to find an archetype with the same name without the octothorp
-			if (name.at(0) == '#')
-			{
-				// Attempt to find an archetype
-				current = GameObjectManager::GetInstance().CreateFromArchetype(name.substr(1));
-			}
-			else
+			current = ReadObject(parser);
+			// Put the game object into the manager
+			if (current)
 			{
-				current = new GameObject(name);
-				current->Deserialize(parser);
+				// The objects of the level file are loaded with it, so they are never saved into its cells
+				current->SetAlwaysLoaded(true);
+				GameObjectManager::GetInstance().AddObject(current);
 			}
-			// Put the game object into the manager
-			GameObjectManager::GetInstance().AddObject(current);
 		}
 		parser.Skip("}");
 	}
@@ -197,7 +199,127 @@ void Junior::GameObjectFactory::FillLevel(const std::string& levelName) const
 	}
 }
 
+Junior::GameObject* Junior::GameObjectFactory::ReadObject(Parser& parser) const
+{
+	// Read the name of the game object
+	std::string name;
+	parser.ReadValue(name);
+	// If the name starts with a #, then we attempt to find an archetype with the same name without the octothorp
+	if (name.at(0) == '#')
+	{
+		return GameObjectManager::GetInstance().CreateFromArchetype(name.substr(1));
+	}
 
+	GameObject* object = new GameObject(name);
+	try
+	{
+		object->Deserialize(parser);
+	}
+	catch (const ParserException&)
+	{
+		delete object;
+		throw;
+	}
+	return object;
+}
+
+void Junior::GameObjectFactory::StreamLevel(const std::string& levelName) const
+{
+	// The level file holds the archetypes and the objects that are always loaded
+	FillLevel(levelName);
+
+	Parser parser(filePath_ + levelName + cellIndexExtension_, std::ios_base::in);
+	try
+	{
+		parser.Skip(levelName);
+		parser.Skip("{");
+		float cellSize;
+		parser.ReadVariable("cellSize", cellSize);
+		unsigned numCells;
+		parser.ReadVariable("numCells", numCells);
+		parser.Skip("{");
+		std::vector<LevelCell> cells(numCells);
+		for (LevelCell& cell : cells)
+		{
+			parser.ReadValue(cell.x_);
+			parser.ReadValue(cell.y_);
+			parser.ReadValue(cell.numObjects_);
+		}
+		parser.Skip("}");
+		parser.Skip("}");
+		LevelStreamer::GetInstance().Open(levelName, cellSize, cells);
+	}
+	catch (const ParserException& e)
+	{
+		Debug& debug = Debug::GetInstance();
+		debug.Print(debug.GetDebugLevelName(DebugLevel::ERROR));
+		debug.Print("Failed to read the cells of level \"" + levelName + "\": ");
+		debug.PrintLn(e.what());
+	}
+}
+
+void Junior::GameObjectFactory::SaveLevelCells(const std::string& levelName, float cellSize) const
+{
+	// Sort the objects into cells by where they are, ordered so the files come out the same every time
+	std::map<std::pair<int, int>, std::vector<const GameObject*>> cells;
+	GameObjectManager::GetInstance().Each<Transform>([&cells, cellSize](Transform& transform)
+	{
+		// The objects loaded with the level file, and the camera the cells stream around, would be created twice
+		const GameObject* object = transform.GetOwner();
+		if (object->IsAlwaysLoaded() || object->GetComponent<Camera>())
+		{
+			return;
+		}
+		Vec3 position = transform.GetGlobalTranslation();
+		std::pair<int, int> cell(static_cast<int>(std::floor(position.x_ / cellSize)), static_cast<int>(std::floor(position.y_ / cellSize)));
+		cells[cell].push_back(object);
+	});
+
+	try
+	{
+		// Every cell goes into its own file, laid out like the objects of a level
+		for (const auto& cell : cells)
+		{
+			Parser parser(GetCellFilePath(levelName, cell.first.first, cell.first.second), std::ios_base::out);
+			parser.WriteValue(levelName + "_" + std::to_string(cell.first.first) + "_" + std::to_string(cell.first.second));
+			parser.StarScope();
+			parser.WriteVariable("numGameObjects", cell.second.size());
+			parser.StarScope();
+			for (const GameObject* object : cell.second)
+			{
+				object->Serialize(parser);
+			}
+			parser.EndScope();
+			parser.EndScope();
+		}
+
+		// Then the list of cells, with the number of objects in each so the streamer can budget before reading them
+		Parser parser(filePath_ + levelName + cellIndexExtension_, std::ios_base::out);
+		parser.WriteValue(levelName);
+		parser.StarScope();
+		parser.WriteVariable("cellSize", cellSize);
+		parser.WriteVariable("numCells", cells.size());
+		parser.StarScope();
+		for (const auto& cell : cells)
+		{
+			parser.WriteValue(std::to_string(cell.first.first) + " " + std::to_string(cell.first.second) + " " + std::to_string(cell.second.size()));
+		}
+		parser.EndScope();
+		parser.EndScope();
+	}
+	catch (const ParserException& e)
+	{
+		Debug& debug = Debug::GetInstance();
+		debug.Print(debug.GetDebugLevelName(DebugLevel::ERROR));
+		debug.Print("Failed to save the cells of level \"" + levelName + "\": ");
+		debug.PrintLn(e.what());
+	}
+}
+
+std::string Junior::GameObjectFactory::GetCellFilePath(const std::string& levelName, int x, int y) const
+{
+	return filePath_ + levelName + "_" + std::to_string(x) + "_" + std::to_string(y) + cellFileExtension_;
+}
 
 Junior::GameObjectFactory& Junior::GameObjectFactory::GetInstance()
 {
@@ -4,81 +4,392 @@
 * File name: GameObjectManager.cpp
 * Description: Takes care to initialize, update, and clean up all of the objects
 * Created: 11 Dec 2018
-* Last Modified: 10 Sep 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include "GameObjectManager.h"			// Game Object Manager
 #include "GameObject.h"					// Game Object
 #include "Time.h"						// Time
+#include "Transform.h"					// Transform
+#include "TransformHierarchy.h"			// Transform Hierarchy
+#include "JobSystem.h"					// Job System
+#include "ActivationSystem.h"			// Activation System
+#include "LevelStreamer.h"				// Level Streamer
+#include <algorithm>					// Sort, Unique
+#include <cmath>						// Float Modulo
 
 
 Junior::GameObjectManager::GameObjectManager()
-	: GameSystem("GameObjectManager"), fixedDtTarget_(1.0/60.0), fixedDtAccumulator_(0.0f), gameObjects_(), archetypes_(), destroyedObjects_()
+	: GameSystem("GameObjectManager"), fixedDtTarget_(1.0/60.0), fixedDtAccumulator_(0.0f), maxSubsteps_(5), substepsLastFrame_(0),
+	droppedTime_(0.0), interpolationAlpha_(0.0f), gameObjects_(), archetypes_(), objectsByName_(), nameIDs_(), archetypesByName_(), destroyedObjects_(),
+	storageMode_(ARCHETYPE_STORAGE), storages_(), updateMode_(SERIAL_UPDATE), phases_(), fixedPhases_(), phasesDirty_(true),
+	fixedPhasesDirty_(true), updatingObjects_(), fixedUpdatingObjects_(), queries_()
 {
 }
 
-bool Junior::GameObjectManager::Load()
+void Junior::GameObjectManager::IndexName(GameObject* object)
 {
-	return true;
+	std::vector<GameObject*>& objects = objectsByName_[object->nameID_];
+	// The string only has to be hashed the first time a name is used
+	if (objects.empty())
+	{
+		nameIDs_.insert(std::make_pair(object->name_, object->nameID_));
+	}
+	object->nameSlot_ = objects.size();
+	objects.push_back(object);
 }
 
-bool Junior::GameObjectManager::Initialize()
+void Junior::GameObjectManager::UnindexName(GameObject* object, NameID name)
 {
-	return true;
+	auto found = objectsByName_.find(name);
+	if (found == objectsByName_.end())
+	{
+		return;
+	}
+
+	// Shift the objects after it down, so the oldest object with the name stays first
+	std::vector<GameObject*>& objects = found->second;
+	objects.erase(objects.begin() + object->nameSlot_);
+	for (size_t i = object->nameSlot_; i < objects.size(); ++i)
+	{
+		objects[i]->nameSlot_ = i;
+	}
+	object->nameSlot_ = 0;
+	if (objects.empty())
+	{
+		objectsByName_.erase(found);
+	}
 }
 
-void Junior::GameObjectManager::Render()
+void Junior::GameObjectManager::CompactName(NameID name)
+{
+	auto found = objectsByName_.find(name);
+	if (found == objectsByName_.end())
+	{
+		return;
+	}
+
+	std::vector<GameObject*>& objects = found->second;
+	size_t count = 0;
+	for (GameObject* object : objects)
+	{
+		if (object)
+		{
+			object->nameSlot_ = count;
+			objects[count++] = object;
+		}
+	}
+	objects.resize(count);
+	if (objects.empty())
+	{
+		objectsByName_.erase(found);
+	}
+}
+
+Junior::GameObjectManager::ComponentQuery& Junior::GameObjectManager::GetQuery(unsigned long long signature)
 {
+	auto found = queries_.find(signature);
+	if (found != queries_.end())
+	{
+		return found->second;
+	}
 
+	// Later changes keep the query up to date, so every object is only looked through once per signature
+	ComponentQuery& query = queries_[signature];
+	for (GameObject* object : gameObjects_)
+	{
+		if ((object->signature_ & signature) == signature)
+		{
+			query.slots_[object] = query.objects_.size();
+			query.objects_.push_back(object);
+		}
+	}
+	return query;
 }
 
-void Junior::GameObjectManager::Update(double dt)
+void Junior::GameObjectManager::UpdateQueries(GameObject* object, unsigned long long oldSignature, unsigned long long newSignature)
 {
-	for (GameObject* gameObject : gameObjects_)
+	for (auto& entry : queries_)
 	{
-		// First check if the object is destroyed
-		if (gameObject->IsDestroyed())
+		unsigned long long signature = entry.first;
+		ComponentQuery& query = entry.second;
+		bool matched = oldSignature != 0 && (oldSignature & signature) == signature;
+		bool matches = newSignature != 0 && (newSignature & signature) == signature;
+		if (matched == matches)
 		{
-			// If the object is destroyed then put it inside the destroyed tab and not update it
-			destroyedObjects_.push_back(gameObject);
 			continue;
 		}
-		gameObject->Update(Time::GetInstance().GetDeltaTime());
+
+		if (matches)
+		{
+			query.slots_[object] = query.objects_.size();
+			query.objects_.push_back(object);
+			continue;
+		}
+
+		// Move the last object into the empty spot
+		auto slot = query.slots_.find(object);
+		if (slot == query.slots_.end())
+		{
+			continue;
+		}
+		size_t index = slot->second;
+		query.slots_.erase(slot);
+		GameObject* last = query.objects_.back();
+		query.objects_.pop_back();
+		if (index < query.objects_.size())
+		{
+			query.objects_[index] = last;
+			query.slots_[last] = index;
+		}
 	}
+}
 
-	// Perform a fixed update for every
-	fixedDtAccumulator_ += Time::GetInstance().GetDeltaTime();
-	while (fixedDtAccumulator_ >= fixedDtTarget_)
+Junior::ArchetypeStorage& Junior::GameObjectManager::GetStorage(const GameObject* archetype) const
+{
+	const std::vector<ComponentContainer*>& prototypes = archetype->GetComponents();
+	ArchetypeStorage::Key key = ArchetypeStorage::MakeKey(prototypes);
+	auto storage = storages_.find(key);
+	if (storage == storages_.end())
 	{
-		fixedDtAccumulator_ -= fixedDtTarget_;
-		for (GameObject* gameObject : gameObjects_)
+		storage = storages_.insert(std::make_pair(key, new ArchetypeStorage(prototypes))).first;
+	}
+	return *storage->second;
+}
+
+Junior::GameObject* Junior::GameObjectManager::Instantiate(const GameObject* archetype) const
+{
+	if (storageMode_ == OBJECT_STORAGE)
+	{
+		return new GameObject(*archetype);
+	}
+	return new GameObject(*archetype, GetStorage(archetype));
+}
+
+void Junior::GameObjectManager::SetListed(std::vector<GameObject*>& list, size_t GameObject::* slot, GameObject* object, bool listed)
+{
+	bool isListed = object->*slot != GameObject::unmanagedIndex_;
+	if (isListed == listed)
+	{
+		return;
+	}
+
+	if (listed)
+	{
+		object->*slot = list.size();
+		list.push_back(object);
+		return;
+	}
+	size_t index = object->*slot;
+	GameObject* last = list.back();
+	list[index] = last;
+	last->*slot = index;
+	list.pop_back();
+	object->*slot = GameObject::unmanagedIndex_;
+}
+
+void Junior::GameObjectManager::Register(GameObject* object)
+{
+	object->managerIndex_ = gameObjects_.size();
+	gameObjects_.push_back(object);
+	IndexName(object);
+	UpdateQueries(object, 0, object->signature_);
+	RefreshUpdating(object);
+	// The object may be the first one in a new storage
+	MarkPhasesDirty();
+	// Objects destroyed before they were added are still cleaned up by the manager
+	if (object->IsDestroyed())
+	{
+		QueueDestroy(object);
+		return;
+	}
+	// Objects with a transform go dormant outside of the region around the camera, when the game asks for it
+	ActivationSystem& activation = ActivationSystem::GetInstance();
+	if (activation.IsTrackingAdded())
+	{
+		activation.Track(object);
+	}
+}
+
+void Junior::GameObjectManager::MarkPhasesDirty()
+{
+	phasesDirty_ = true;
+	fixedPhasesDirty_ = true;
+}
+
+void Junior::GameObjectManager::UpdateObjects(double dt)
+{
+	if (updateMode_ == PHASED_UPDATE)
+	{
+		// The waves are only built again when objects come, go or change their components
+		if (phasesDirty_)
+		{
+			phases_.Build(updatingObjects_, storages_, false);
+			phasesDirty_ = false;
+		}
+		phases_.Update(dt);
+		return;
+	}
+	// Transforms mark the transforms below them dirty and rebuild the ones above them on demand,
+	// so objects in a transform hierarchy touch each other and can only be updated from one thread
+	if (updateMode_ == SERIAL_UPDATE || TransformHierarchy::GetInstance().GetLevelCount() > 1)
+	{
+		// Objects whose components all live in archetype storage are updated by the storage below
+		// Index the list, since objects created while updating are added to it
+		for (size_t i = 0; i < updatingObjects_.size(); ++i)
+		{
+			if (!updatingObjects_[i]->IsDestroyed())
+			{
+				updatingObjects_[i]->Update(dt);
+			}
+		}
+		// Update the stored components column by column
+		for (auto& storage : storages_)
 		{
-			gameObject->FixedUpdate(fixedDtTarget_);
+			storage.second->Update(dt);
 		}
+		return;
 	}
 
-	// Check if there are any objects that are destroyed
-	if (destroyedObjects_.size() > 0)
+	// Without a hierarchy every object only touches itself, so the objects can be split between the workers
+	JobSystem& jobSystem = JobSystem::GetInstance();
+	jobSystem.ParallelFor(0, updatingObjects_.size(), 0, [this, dt](size_t begin, size_t end)
 	{
-		// Then destroy the objects and remove them from the original list
-		for (GameObject* object : destroyedObjects_)
+		for (size_t i = begin; i < end; ++i)
 		{
-			for (unsigned i = 0; i < gameObjects_.size(); ++i)
+			if (!updatingObjects_[i]->IsDestroyed())
 			{
-				if (object == gameObjects_[i])
-				{
-					gameObjects_.erase(gameObjects_.begin()+i);
-				}
+				updatingObjects_[i]->Update(dt);
 			}
+		}
+	});
+	// The columns still go one after another, only the chunks of a column are split
+	for (auto& storage : storages_)
+	{
+		ArchetypeStorage* archetypeStorage = storage.second;
+		for (size_t column = 0; column < archetypeStorage->GetColumnCount(); ++column)
+		{
+			if (!archetypeStorage->GetColumnLayout(column).updateColumn_)
+			{
+				continue;
+			}
+			jobSystem.ParallelFor(0, archetypeStorage->GetChunkCount(), 1, [archetypeStorage, column, dt](size_t begin, size_t end)
+			{
+				archetypeStorage->UpdateColumn(column, begin, end, dt);
+			});
+		}
+	}
+}
 
-			// Clean up the destroyed object
-			object->Shutdown();
-			object->Unload();
-			delete object;
+void Junior::GameObjectManager::FixedUpdateObjects(double dt)
+{
+	if (updateMode_ == PHASED_UPDATE)
+	{
+		if (fixedPhasesDirty_)
+		{
+			fixedPhases_.Build(fixedUpdatingObjects_, storages_, true);
+			fixedPhasesDirty_ = false;
+		}
+		fixedPhases_.FixedUpdate(dt);
+		return;
+	}
+	// Objects in a transform hierarchy touch each other, like in the update
+	if (updateMode_ == SERIAL_UPDATE || TransformHierarchy::GetInstance().GetLevelCount() > 1)
+	{
+		for (size_t i = 0; i < fixedUpdatingObjects_.size(); ++i)
+		{
+			fixedUpdatingObjects_[i]->FixedUpdate(dt);
+		}
+		for (auto& storage : storages_)
+		{
+			storage.second->FixedUpdate(dt);
+		}
+		return;
+	}
+
+	JobSystem& jobSystem = JobSystem::GetInstance();
+	jobSystem.ParallelFor(0, fixedUpdatingObjects_.size(), 0, [this, dt](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			fixedUpdatingObjects_[i]->FixedUpdate(dt);
 		}
-		destroyedObjects_.clear();
+	});
+	for (auto& storage : storages_)
+	{
+		ArchetypeStorage* archetypeStorage = storage.second;
+		for (size_t column = 0; column < archetypeStorage->GetColumnCount(); ++column)
+		{
+			if (!archetypeStorage->GetColumnLayout(column).fixedUpdateColumn_)
+			{
+				continue;
+			}
+			jobSystem.ParallelFor(0, archetypeStorage->GetChunkCount(), 1, [archetypeStorage, column, dt](size_t begin, size_t end)
+			{
+				archetypeStorage->FixedUpdateColumn(column, begin, end, dt);
+			});
+		}
+	}
+}
+
+bool Junior::GameObjectManager::Load()
+{
+	return true;
+}
+
+bool Junior::GameObjectManager::Initialize()
+{
+	return true;
+}
+
+void Junior::GameObjectManager::Render()
+{
+
+}
+
+void Junior::GameObjectManager::Update(double dt)
+{
+	// Load the cells of the level that came near the camera, before their transforms are rebuilt
+	LevelStreamer::GetInstance().Update();
+	// Start counting the world transformations rebuilt this frame
+	Transform::BeginFrame();
+	TransformHierarchy& hierarchy = TransformHierarchy::GetInstance();
+	// Rebuild the world transformations changed since the last frame, parents before children
+	hierarchy.Update();
+	// Wake up the objects that came into the camera's region, and put the ones that left it to sleep
+	ActivationSystem::GetInstance().Update(Time::GetInstance().GetDeltaTime());
+
+	// Perform the fixed updates first, so the frame's update sees how far it is between two of them
+	fixedDtAccumulator_ += Time::GetInstance().GetDeltaTime();
+	unsigned substeps = 0;
+	while (fixedDtAccumulator_ >= fixedDtTarget_ && substeps < maxSubsteps_)
+	{
+		// The transforms keep their state from before the step, so the world transformations have to be rebuilt first
+		hierarchy.Update();
+		Transform::BeginFixedStep();
+		FixedUpdateObjects(fixedDtTarget_);
+		Transform::EndFixedStep();
+		fixedDtAccumulator_ -= fixedDtTarget_;
+		++substeps;
 	}
+
+	// Drop the whole steps we could not catch up on, keeping the part of a step left over
+	droppedTime_ = 0.0;
+	if (fixedDtAccumulator_ >= fixedDtTarget_)
+	{
+		double leftOver = std::fmod(fixedDtAccumulator_, fixedDtTarget_);
+		droppedTime_ = fixedDtAccumulator_ - leftOver;
+		fixedDtAccumulator_ = leftOver;
+	}
+	substepsLastFrame_ = substeps;
+	interpolationAlpha_ = static_cast<float>(fixedDtAccumulator_ / fixedDtTarget_);
+
+	hierarchy.Update();
+	UpdateObjects(Time::GetInstance().GetDeltaTime());
+
+	// Clean up everything destroyed this frame
+	CollectDestroyed();
 }
 
 void Junior::GameObjectManager::Shutdown()
@@ -96,8 +407,12 @@ void Junior::GameObjectManager::Shutdown()
 
 void Junior::GameObjectManager::Unload()
 {
+	LevelStreamer::GetInstance().Close();
+	ActivationSystem::GetInstance().Clear();
 	for (GameObject* gameObject : gameObjects_)
 	{
+		// The object is no longer owned, so destroying it while deleting does not queue it
+		gameObject->managerIndex_ = GameObject::unmanagedIndex_;
 		gameObject->Unload();
 		delete gameObject;
 	}
@@ -108,54 +423,334 @@ void Junior::GameObjectManager::Unload()
 		delete archetype;
 	}
 
+	// The objects released their rows already, so the storages are empty by now
+	for (auto& storage : storages_)
+	{
+		delete storage.second;
+	}
+
 	gameObjects_.clear();
 	archetypes_.clear();
+	objectsByName_.clear();
+	nameIDs_.clear();
+	archetypesByName_.clear();
+	queries_.clear();
+	updatingObjects_.clear();
+	fixedUpdatingObjects_.clear();
+	storages_.clear();
+	destroyedObjects_.clear();
+	MarkPhasesDirty();
 }
 
 void Junior::GameObjectManager::AddObject(GameObject* const object)
 {
 	object->Initialize();
-	gameObjects_.push_back(object);
+	Register(object);
 }
 
 void Junior::GameObjectManager::AddArchetype(GameObject* const archetype)
 {
 	archetype->Initialize();
 	archetypes_.push_back(archetype);
+	// Earlier archetypes keep the name, like the first match of a search through the list
+	archetypesByName_.insert(std::make_pair(archetype->nameID_, archetype));
+	nameIDs_.insert(std::make_pair(archetype->name_, archetype->nameID_));
 }
 
-Junior::GameObject* Junior::GameObjectManager::FindByName(const std::string& name) const
+void Junior::GameObjectManager::QueueDestroy(GameObject* object)
+{
+	std::lock_guard<std::mutex> lock(destroyedMutex_);
+	destroyedObjects_.push_back(object);
+	// Destroyed objects are left out of the next build, even before they are collected
+	MarkPhasesDirty();
+}
+
+void Junior::GameObjectManager::CollectDestroyed()
+{
+	std::vector<GameObject*> destroyed;
+	std::vector<NameID> names;
+	while (!destroyedObjects_.empty())
+	{
+		destroyed.clear();
+		destroyed.swap(destroyedObjects_);
+		names.clear();
+
+		// Take the objects out of the list first, moving the last object into every empty spot
+		for (GameObject* object : destroyed)
+		{
+			size_t index = object->managerIndex_;
+			if (index == GameObject::unmanagedIndex_)
+			{
+				continue;
+			}
+			// Destroyed objects are never woken up, dormant ones stay asleep and are already out of the update lists below
+			ActivationSystem::GetInstance().Untrack(object);
+			GameObject* last = gameObjects_.back();
+			gameObjects_[index] = last;
+			last->managerIndex_ = index;
+			gameObjects_.pop_back();
+			object->managerIndex_ = GameObject::unmanagedIndex_;
+			// Leave a hole in the name's list, every list is closed up once below so destroying many objects stays linear
+			objectsByName_[object->nameID_][object->nameSlot_] = nullptr;
+			names.push_back(object->nameID_);
+			UpdateQueries(object, object->signature_, 0);
+			SetListed(updatingObjects_, &GameObject::updateSlot_, object, false);
+			SetListed(fixedUpdatingObjects_, &GameObject::fixedUpdateSlot_, object, false);
+		}
+		MarkPhasesDirty();
+		std::sort(names.begin(), names.end());
+		names.erase(std::unique(names.begin(), names.end()), names.end());
+		for (NameID name : names)
+		{
+			CompactName(name);
+		}
+
+		// Then clean them up one step at a time, any objects destroyed here go into the next round
+		for (GameObject* object : destroyed)
+		{
+			object->Shutdown();
+		}
+		for (GameObject* object : destroyed)
+		{
+			object->Unload();
+		}
+		for (GameObject* object : destroyed)
+		{
+			delete object;
+		}
+	}
+}
+
+void Junior::GameObjectManager::RenameObject(GameObject* object, NameID oldName)
 {
-	for (auto begin = gameObjects_.cbegin(); begin != gameObjects_.cend(); ++begin)
+	if (object->nameID_ == oldName)
 	{
-		if ((*begin)->GetName() == name)
+		return;
+	}
+	UnindexName(object, oldName);
+	IndexName(object);
+}
+
+void Junior::GameObjectManager::RenameArchetype(GameObject* archetype, NameID oldName)
+{
+	auto found = archetypesByName_.find(oldName);
+	if (found == archetypesByName_.end() || found->second != archetype)
+	{
+		return;
+	}
+	archetypesByName_.erase(found);
+
+	// Another archetype with the old name takes it over, in the order they were added
+	for (GameObject* other : archetypes_)
+	{
+		if (other != archetype && other->nameID_ == oldName)
 		{
-			return *begin;
+			archetypesByName_.insert(std::make_pair(oldName, other));
+			break;
 		}
 	}
+	archetypesByName_.insert(std::make_pair(archetype->nameID_, archetype));
+	nameIDs_.insert(std::make_pair(archetype->name_, archetype->nameID_));
+}
+
+Junior::GameObject* Junior::GameObjectManager::FindByName(const std::string& name) const
+{
+	auto found = nameIDs_.find(name);
+	return found != nameIDs_.end() ? FindByName(found->second) : nullptr;
+}
+
+Junior::GameObject* Junior::GameObjectManager::FindByName(NameID name) const
+{
+	auto found = objectsByName_.find(name);
+	return found != objectsByName_.end() ? found->second.front() : nullptr;
+}
 
-	return nullptr;
+const std::vector<Junior::GameObject*>& Junior::GameObjectManager::FindAllByName(const std::string& name) const
+{
+	auto found = nameIDs_.find(name);
+	return FindAllByName(found != nameIDs_.end() ? found->second : invalidNameID);
+}
+
+const std::vector<Junior::GameObject*>& Junior::GameObjectManager::FindAllByName(NameID name) const
+{
+	static const std::vector<GameObject*> none;
+	auto found = objectsByName_.find(name);
+	return found != objectsByName_.end() ? found->second : none;
 }
 
 Junior::GameObject* Junior::GameObjectManager::CreateFromArchetype(const std::string& name) const
 {
-	for (auto begin = archetypes_.cbegin(); begin != archetypes_.cend(); ++begin)
+	auto found = nameIDs_.find(name);
+	return found != nameIDs_.end() ? CreateFromArchetype(found->second) : nullptr;
+}
+
+Junior::GameObject* Junior::GameObjectManager::CreateFromArchetype(NameID name) const
+{
+	auto found = archetypesByName_.find(name);
+	if (found == archetypesByName_.end())
+	{
+		return nullptr;
+	}
+
+	return Instantiate(found->second);
+}
+
+size_t Junior::GameObjectManager::SpawnBatch(const std::string& name, size_t count, const SpawnFunction& function, std::vector<GameObject*>* spawned)
+{
+	auto found = nameIDs_.find(name);
+	return found != nameIDs_.end() ? SpawnBatch(found->second, count, function, spawned) : 0;
+}
+
+size_t Junior::GameObjectManager::SpawnBatch(NameID name, size_t count, const SpawnFunction& function, std::vector<GameObject*>* spawned)
+{
+	auto found = archetypesByName_.find(name);
+	if (found == archetypesByName_.end() || count == 0)
+	{
+		return 0;
+	}
+	const GameObject* archetype = found->second;
+
+	// Grow everything once for the whole batch
+	gameObjects_.reserve(gameObjects_.size() + count);
+	std::vector<GameObject*>& named = objectsByName_[archetype->nameID_];
+	named.reserve(named.size() + count);
+	if (storageMode_ == ARCHETYPE_STORAGE)
+	{
+		GetStorage(archetype).Reserve(count);
+	}
+	std::vector<GameObject*> batch;
+	batch.reserve(count);
+
+	// Clone every object, the stored components fill the storage's rows one after another
+	// The clones are remembered before the function runs, since it may remove them or add components of its own
+	size_t prototypeCount = archetype->GetComponents().size();
+	std::vector<ComponentContainer*> cloned;
+	cloned.reserve(count * prototypeCount);
+	for (size_t i = 0; i < count; ++i)
+	{
+		GameObject* object = Instantiate(archetype);
+		batch.push_back(object);
+		cloned.insert(cloned.end(), object->components_.begin(), object->components_.begin() + prototypeCount);
+	}
+	if (function)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			function(batch[i], i);
+		}
+	}
+
+	// Initialize one component of the archetype for every object before moving to the next one, so each pass runs the same code
+	// Components added by the function were already initialized when they were added, and removed clones are skipped
+	for (size_t component = 0; component < prototypeCount; ++component)
 	{
-		if ((*begin)->GetName() == name)
+		for (size_t i = 0; i < count; ++i)
 		{
-			return new GameObject(**begin);
+			ComponentContainer* clone = cloned[i * prototypeCount + component];
+			const std::vector<ComponentContainer*>& components = batch[i]->components_;
+			if (!function || std::find(components.begin(), components.end(), clone) != components.end())
+			{
+				clone->Initialize();
+			}
 		}
 	}
 
-	return nullptr;
+	for (GameObject* object : batch)
+	{
+		Register(object);
+	}
+	if (spawned)
+	{
+		spawned->insert(spawned->end(), batch.begin(), batch.end());
+	}
+	return count;
 }
 
-	
 const std::vector<Junior::GameObject*>& Junior::GameObjectManager::GetAllObjects() const
 {
 	return gameObjects_;
 }
 
+void Junior::GameObjectManager::SetStorageMode(StorageMode mode)
+{
+	storageMode_ = mode;
+}
+
+Junior::StorageMode Junior::GameObjectManager::GetStorageMode() const
+{
+	return storageMode_;
+}
+
+void Junior::GameObjectManager::SetUpdateMode(UpdateMode mode)
+{
+	updateMode_ = mode;
+}
+
+Junior::UpdateMode Junior::GameObjectManager::GetUpdateMode() const
+{
+	return updateMode_;
+}
+
+void Junior::GameObjectManager::RefreshUpdating(GameObject* object)
+{
+	if (object->managerIndex_ == GameObject::unmanagedIndex_)
+	{
+		return;
+	}
+	SetListed(updatingObjects_, &GameObject::updateSlot_, object, !object->sleeping_ && !object->updating_.empty());
+	SetListed(fixedUpdatingObjects_, &GameObject::fixedUpdateSlot_, object, !object->sleeping_ && !object->fixedUpdating_.empty());
+	// The object's components may have changed even when it stays in the same lists
+	MarkPhasesDirty();
+}
+
+size_t Junior::GameObjectManager::GetUpdatingCount() const
+{
+	return updatingObjects_.size();
+}
+
+void Junior::GameObjectManager::SetFixedTimestep(double dt)
+{
+	// A step that takes no time would run the most substeps every frame and turn the accumulator into NaN
+	if (!(dt > 0.0))
+	{
+		return;
+	}
+	fixedDtTarget_ = dt;
+}
+
+double Junior::GameObjectManager::GetFixedTimestep() const
+{
+	return fixedDtTarget_;
+}
+
+void Junior::GameObjectManager::SetMaxSubsteps(unsigned substeps)
+{
+	maxSubsteps_ = substeps;
+}
+
+unsigned Junior::GameObjectManager::GetSubstepCount() const
+{
+	return substepsLastFrame_;
+}
+
+double Junior::GameObjectManager::GetDroppedTime() const
+{
+	return droppedTime_;
+}
+
+float Junior::GameObjectManager::GetInterpolationAlpha() const
+{
+	return interpolationAlpha_;
+}
+
+void Junior::GameObjectManager::ChangeSignature(GameObject* object, unsigned long long oldSignature)
+{
+	if (object->managerIndex_ != GameObject::unmanagedIndex_ && object->signature_ != oldSignature)
+	{
+		UpdateQueries(object, oldSignature, object->signature_);
+	}
+}
+
 Junior::GameObjectManager& Junior::GameObjectManager::GetInstance()
 {
 	static GameObjectManager singleton_;
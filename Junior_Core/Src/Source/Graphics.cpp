@@ -4,7 +4,7 @@
 * File name: Graphics.cpp
 * Description: Write the functionality of the window and the renderer under the same class
 * Created: 20 Apr 2018
-* Last Modified: 8 Aug 2019
+* Last Modified: 17 Oct 2026
 */
 
 
@@ -48,8 +48,8 @@ std::string Junior::WindowQuitEvent::WindowQuitEventName = "WindowQuit";
 
 // Private Member Functions
 Junior::Graphics::Graphics()
-	: GameSystem("Graphics"), windowWidth_(0), windowHeight_(0), openGLVersionMajor_(0), openGLVersionMinor_(0),
-							  windowHandle_(nullptr), mainCamera_(nullptr), orthographicMatrix_()
+	: GameSystem("Graphics"), mainCamera_(nullptr), windowWidth_(0), windowHeight_(0), openGLVersionMajor_(0), openGLVersionMinor_(0),
+							  windowHandle_(nullptr), renderQueue_(), orthographicMatrix_()
 {
 }
 
@@ -224,30 +224,16 @@ void Junior::Graphics::Render()
 	// Which for now, its pretty much always
 	glClear(GL_COLOR_BUFFER_BIT);
 
-	// Bind each program and draw the meshes
-	for (auto program = programs_.cbegin(); program != programs_.end(); ++program)
+	// Every mesh adds its draw commands, which are sorted so the state only changes when it has to
+	renderQueue_.Clear();
+	for (size_t i = 0; i < programs_.size(); ++i)
 	{
-		(*program)->Bind();
-		// Update the camera
-		GLuint projLoc = glGetUniformLocation((*program)->programID_, "camera");
-		if (mainCamera_)
-			glUniformMatrix4fv(projLoc, 1, GL_FALSE, mainCamera_->GetCameraMatrix().m_);
-		else
-			glUniformMatrix4fv(projLoc, 1, GL_FALSE, Identity().m_);
-
-		// Set the texture atlas
-		GLuint textureLoc = glGetUniformLocation((*program)->programID_, "diffuse");
-		glActiveTexture(GL_TEXTURE0);
-		textureBank_->BindTexture();
-		glUniform1i(textureLoc, 0);
-
-		// Draw the instanced meshes
-		(*program)->Draw();
-
-		textureBank_->UnbindTexture();
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-		(*program)->UnBind();
+		programs_[i]->Submit(renderQueue_, static_cast<unsigned>(i));
 	}
+	renderQueue_.Sort();
+
+	// Draw the commands with the camera
+	renderQueue_.Execute(mainCamera_ ? mainCamera_->GetCameraMatrix() : Identity(), textureBank_);
 
 	// And swap the buffers
 	glfwSwapBuffers(windowHandle_);
@@ -296,6 +282,11 @@ Junior::TextureAtlas* Junior::Graphics::GetTextureAtlas()
 	return atlas_;
 }
 
+const Junior::RenderQueue& Junior::Graphics::GetRenderQueue() const
+{
+	return renderQueue_;
+}
+
 int Junior::Graphics::GetWindowWidth() const
 {
 	return windowWidth_;
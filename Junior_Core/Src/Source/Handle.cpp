@@ -0,0 +1,106 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: Handle.cpp
+* Description: Generational handles to objects and components, which turn null once their target is deleted
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "Handle.h"				// Handle
+
+// Private Member Functions
+
+Junior::HandleTable::HandleTable()
+	: blocks_(), blockCount_(0), freeSlots_(), liveCount_(0)
+{
+}
+
+Junior::HandleTable::~HandleTable()
+{
+	for (unsigned i = 0; i < blockCount_; ++i)
+	{
+		delete[] blocks_[i];
+	}
+}
+
+// Public Member Functions
+
+Junior::HandleID Junior::HandleTable::Register(void* target)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (freeSlots_.empty())
+	{
+		if (blockCount_ == maxBlocks_)
+		{
+			return HandleID();
+		}
+
+		// Every slot starts at the first generation, zero is kept for null handles
+		Slot* block = new Slot[slotsPerBlock_];
+		for (unsigned i = 0; i < slotsPerBlock_; ++i)
+		{
+			block[i].target_.store(nullptr, std::memory_order_relaxed);
+			block[i].generation_.store(1, std::memory_order_relaxed);
+		}
+		// Push the new slots backwards so the lowest index is used first
+		unsigned blockCount = blockCount_.load(std::memory_order_relaxed);
+		unsigned first = blockCount * slotsPerBlock_;
+		for (unsigned i = slotsPerBlock_; i > 0; --i)
+		{
+			freeSlots_.push_back(first + i - 1);
+		}
+		// Publish the block only once it is filled in, so threads resolving handles never see it half built
+		blocks_[blockCount] = block;
+		blockCount_.store(blockCount + 1, std::memory_order_release);
+	}
+
+	unsigned index = freeSlots_.back();
+	freeSlots_.pop_back();
+	Slot& slot = blocks_[index / slotsPerBlock_][index % slotsPerBlock_];
+	slot.target_.store(target, std::memory_order_release);
+	++liveCount_;
+
+	HandleID handle;
+	handle.index_ = index;
+	handle.generation_ = slot.generation_.load(std::memory_order_relaxed);
+	return handle;
+}
+
+void Junior::HandleTable::Release(HandleID handle)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (handle.IsNull() || handle.index_ >= blockCount_ * slotsPerBlock_)
+	{
+		return;
+	}
+	Slot& slot = blocks_[handle.index_ / slotsPerBlock_][handle.index_ % slotsPerBlock_];
+	if (slot.generation_.load(std::memory_order_relaxed) != handle.generation_)
+	{
+		return;
+	}
+
+	// The generation changes before the target, see Resolve
+	// Skip zero when the generation wraps around, so a slot never makes a null handle
+	unsigned generation = handle.generation_ + 1;
+	if (generation == 0)
+	{
+		generation = 1;
+	}
+	slot.generation_.store(generation, std::memory_order_release);
+	slot.target_.store(nullptr, std::memory_order_release);
+	freeSlots_.push_back(handle.index_);
+	--liveCount_;
+}
+
+size_t Junior::HandleTable::GetLiveCount() const
+{
+	return liveCount_;
+}
+
+Junior::HandleTable& Junior::HandleTable::GetInstance()
+{
+	static HandleTable singleton_;
+	return singleton_;
+}
\ No newline at end of file
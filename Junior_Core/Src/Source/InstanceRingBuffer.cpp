@@ -0,0 +1,188 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: InstanceRingBuffer.cpp
+* Description: A vertex buffer split into three regions that are written by the CPU while the GPU reads the others, guarded by fences
+* Created: 17-Oct-2026
+* Last Modified: 17-Oct-2026
+*/
+
+// Includes //
+#include "InstanceRingBuffer.h"
+#include <cstring>				// Memory Copy
+
+// Private Static Variables //
+
+bool Junior::InstanceRingBuffer::allowPersistentMapping_ = true;
+
+// Private Member Functions //
+
+void Junior::InstanceRingBuffer::CreateBuffer()
+{
+	size_t totalSize = regionSize_ * NUM_REGIONS;
+	glGenBuffers(1, &bufferObject_);
+	glBindBuffer(GL_ARRAY_BUFFER, bufferObject_);
+
+	// Persistent mapping needs OpenGL 4.4, or the extension on older contexts like Mesa's 3.3 core one
+	persistent_ = allowPersistentMapping_ && (GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage);
+	if (persistent_)
+	{
+		// Coherent, so the writes reach the GPU without flushing them
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_ARRAY_BUFFER, totalSize, nullptr, flags);
+		mapped_ = static_cast<unsigned char*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, totalSize, flags));
+		// Fall back to uploading every range when the driver does not hand out the mapping
+		if (!mapped_)
+		{
+			persistent_ = false;
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			glDeleteBuffers(1, &bufferObject_);
+			glGenBuffers(1, &bufferObject_);
+			glBindBuffer(GL_ARRAY_BUFFER, bufferObject_);
+		}
+	}
+	if (!persistent_)
+	{
+		mapped_ = nullptr;
+		glBufferData(GL_ARRAY_BUFFER, totalSize, nullptr, GL_DYNAMIC_DRAW);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void Junior::InstanceRingBuffer::DestroyBuffer()
+{
+	for (unsigned i = 0; i < NUM_REGIONS; ++i)
+	{
+		WaitForRegion(i);
+	}
+	if (mapped_)
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, bufferObject_);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		mapped_ = nullptr;
+	}
+	glDeleteBuffers(1, &bufferObject_);
+	bufferObject_ = 0;
+}
+
+bool Junior::InstanceRingBuffer::WaitForRegion(unsigned region)
+{
+	GLsync fence = fences_[region];
+	if (!fence)
+	{
+		return false;
+	}
+
+	// Check without waiting first, so only the writes that actually wait are counted
+	GLenum status = glClientWaitSync(fence, 0, 0);
+	bool stalled = status == GL_TIMEOUT_EXPIRED;
+	while (status == GL_TIMEOUT_EXPIRED)
+	{
+		status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+	}
+	glDeleteSync(fence);
+	fences_[region] = nullptr;
+	return stalled;
+}
+
+// Public Member Functions //
+
+Junior::InstanceRingBuffer::InstanceRingBuffer(size_t regionSize)
+	: bufferObject_(0), regionSize_(regionSize > 0 ? regionSize : 1), persistent_(false), mapped_(nullptr), currentRegion_(0),
+	bytesUploaded_(0), fenceStalls_(0)
+{
+	for (unsigned i = 0; i < NUM_REGIONS; ++i)
+	{
+		fences_[i] = nullptr;
+	}
+	CreateBuffer();
+}
+
+Junior::InstanceRingBuffer::~InstanceRingBuffer()
+{
+	DestroyBuffer();
+}
+
+bool Junior::InstanceRingBuffer::BeginWrite(size_t size)
+{
+	fenceStalls_ = 0;
+	bytesUploaded_ = 0;
+	// A bigger write rebuilds the buffer, doubling it so it does not grow every frame
+	bool grew = size > regionSize_;
+	if (grew)
+	{
+		DestroyBuffer();
+		while (regionSize_ < size)
+		{
+			regionSize_ *= 2;
+		}
+		CreateBuffer();
+		currentRegion_ = 0;
+	}
+
+	if (WaitForRegion(currentRegion_))
+	{
+		++fenceStalls_;
+	}
+	return grew;
+}
+
+void Junior::InstanceRingBuffer::WriteRange(size_t offset, const void* data, size_t size)
+{
+	offset += regionSize_ * currentRegion_;
+	if (persistent_)
+	{
+		std::memcpy(mapped_ + offset, data, size);
+	}
+	else
+	{
+		// The fences already keep the GPU off the region, so the upload does not overwrite anything being drawn
+		glBindBuffer(GL_ARRAY_BUFFER, bufferObject_);
+		glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+	}
+	bytesUploaded_ += size;
+}
+
+size_t Junior::InstanceRingBuffer::EndWrite()
+{
+	return regionSize_ * currentRegion_;
+}
+
+unsigned Junior::InstanceRingBuffer::GetCurrentRegion() const
+{
+	return currentRegion_;
+}
+
+void Junior::InstanceRingBuffer::Fence()
+{
+	fences_[currentRegion_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	currentRegion_ = (currentRegion_ + 1) % NUM_REGIONS;
+}
+
+GLuint Junior::InstanceRingBuffer::GetBufferObject() const
+{
+	return bufferObject_;
+}
+
+bool Junior::InstanceRingBuffer::IsPersistent() const
+{
+	return persistent_;
+}
+
+size_t Junior::InstanceRingBuffer::GetBytesUploaded() const
+{
+	return bytesUploaded_;
+}
+
+unsigned Junior::InstanceRingBuffer::GetFenceStallCount() const
+{
+	return fenceStalls_;
+}
+
+// Public Static Functions //
+
+void Junior::InstanceRingBuffer::AllowPersistentMapping(bool allow)
+{
+	allowPersistentMapping_ = allow;
+}
\ No newline at end of file
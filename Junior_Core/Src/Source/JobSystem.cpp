@@ -0,0 +1,280 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: JobSystem.cpp
+* Description: Runs small jobs on a fixed pool of worker threads, each worker steals from the others when it runs out of work
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "JobSystem.h"			// Job System
+#include <algorithm>			// Max
+
+// Global Variables
+
+// The queue of the thread running, the main thread and any thread outside of the system use the first queue
+static thread_local unsigned currentQueue = 0;
+
+// Job Counter
+
+Junior::JobCounter::JobCounter()
+	: pending_(0), mutex_(), waiting_()
+{
+}
+
+bool Junior::JobCounter::IsDone() const
+{
+	return pending_ == 0;
+}
+
+unsigned Junior::JobCounter::GetPending() const
+{
+	return pending_;
+}
+
+// Private Member Functions
+
+Junior::JobSystem::JobSystem()
+	: GameSystem("JobSystem"), workers_(), queues_(), queuedJobs_(0), quitting_(false), requestedWorkers_(0)
+{
+}
+
+void Junior::JobSystem::WorkerLoop(unsigned queue)
+{
+	currentQueue = queue;
+	while (!quitting_)
+	{
+		Job job;
+		if (FindJob(job))
+		{
+			Execute(job);
+			continue;
+		}
+
+		// Sleep until there is something to do
+		std::unique_lock<std::mutex> lock(sleepMutex_);
+		wakeUp_.wait(lock, [this]() { return queuedJobs_ > 0 || quitting_; });
+	}
+}
+
+bool Junior::JobSystem::FindJob(Job& job)
+{
+	if (queuedJobs_ == 0 || queues_.empty())
+	{
+		return false;
+	}
+
+	// Take the newest job of our own queue, since its data is most likely still in the cache
+	unsigned queueCount = static_cast<unsigned>(queues_.size());
+	{
+		WorkQueue& own = *queues_[currentQueue];
+		std::lock_guard<std::mutex> lock(own.mutex_);
+		if (!own.jobs_.empty())
+		{
+			job = std::move(own.jobs_.back());
+			own.jobs_.pop_back();
+			--queuedJobs_;
+			return true;
+		}
+	}
+
+	// Otherwise steal the oldest job of another queue
+	for (unsigned i = 1; i < queueCount; ++i)
+	{
+		WorkQueue& other = *queues_[(currentQueue + i) % queueCount];
+		std::lock_guard<std::mutex> lock(other.mutex_);
+		if (!other.jobs_.empty())
+		{
+			job = std::move(other.jobs_.front());
+			other.jobs_.pop_front();
+			--queuedJobs_;
+			return true;
+		}
+	}
+	return false;
+}
+
+void Junior::JobSystem::Queue(Job& job)
+{
+	// Without workers the job is run right away
+	if (workers_.empty())
+	{
+		Execute(job);
+		return;
+	}
+
+	{
+		WorkQueue& own = *queues_[currentQueue];
+		std::lock_guard<std::mutex> lock(own.mutex_);
+		own.jobs_.push_back(std::move(job));
+		++queuedJobs_;
+	}
+	// Taking the lock makes sure a worker about to sleep sees the new job or gets woken up
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+	}
+	wakeUp_.notify_one();
+}
+
+void Junior::JobSystem::Execute(Job& job)
+{
+	job.function_();
+	if (job.counter_)
+	{
+		Finish(*job.counter_);
+	}
+}
+
+void Junior::JobSystem::Finish(JobCounter& counter)
+{
+	std::vector<Job> ready;
+	{
+		std::lock_guard<std::mutex> lock(counter.mutex_);
+		if (--counter.pending_ == 0)
+		{
+			ready.swap(counter.waiting_);
+		}
+	}
+	// The counter may be gone from here on, so only the jobs taken out of it are used
+	for (Job& job : ready)
+	{
+		Queue(job);
+	}
+}
+
+// Public Member Functions
+
+bool Junior::JobSystem::Load()
+{
+	if (!workers_.empty())
+	{
+		return true;
+	}
+
+	unsigned workerCount = requestedWorkers_;
+	if (workerCount == 0)
+	{
+		workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+	}
+
+	quitting_ = false;
+	for (unsigned i = 0; i <= workerCount; ++i)
+	{
+		queues_.push_back(new WorkQueue);
+	}
+	for (unsigned i = 1; i <= workerCount; ++i)
+	{
+		workers_.push_back(std::thread(&JobSystem::WorkerLoop, this, i));
+	}
+	return true;
+}
+
+bool Junior::JobSystem::Initialize()
+{
+	return true;
+}
+
+void Junior::JobSystem::Update(double)
+{
+}
+
+void Junior::JobSystem::Render()
+{
+}
+
+void Junior::JobSystem::Shutdown()
+{
+	// Finish whatever is left before the systems the jobs use are shut down
+	Job job;
+	while (FindJob(job))
+	{
+		Execute(job);
+	}
+}
+
+void Junior::JobSystem::Unload()
+{
+	Shutdown();
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+		quitting_ = true;
+	}
+	wakeUp_.notify_all();
+	for (std::thread& worker : workers_)
+	{
+		worker.join();
+	}
+	workers_.clear();
+
+	for (WorkQueue* queue : queues_)
+	{
+		delete queue;
+	}
+	queues_.clear();
+	queuedJobs_ = 0;
+}
+
+void Junior::JobSystem::Run(const JobFunction& function, JobCounter* counter)
+{
+	if (counter)
+	{
+		++counter->pending_;
+	}
+	Job job = { function, counter };
+	Queue(job);
+}
+
+void Junior::JobSystem::RunAfter(JobCounter& dependency, const JobFunction& function, JobCounter* counter)
+{
+	if (counter)
+	{
+		++counter->pending_;
+	}
+	Job job = { function, counter };
+	{
+		// The dependency can only reach zero while its lock is held, so the job cannot be missed
+		std::lock_guard<std::mutex> lock(dependency.mutex_);
+		if (dependency.pending_ != 0)
+		{
+			dependency.waiting_.push_back(std::move(job));
+			return;
+		}
+	}
+	Queue(job);
+}
+
+void Junior::JobSystem::Wait(JobCounter& counter)
+{
+	// Help with the work instead of sleeping, which also keeps nested waits from blocking every worker
+	while (!counter.IsDone())
+	{
+		Job job;
+		if (FindJob(job))
+		{
+			Execute(job);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+	// Wait for the last job to let go of the counter, the caller is free to destroy it afterwards
+	std::lock_guard<std::mutex> lock(counter.mutex_);
+}
+
+void Junior::JobSystem::SetWorkerCount(unsigned count)
+{
+	requestedWorkers_ = count;
+}
+
+unsigned Junior::JobSystem::GetThreadCount() const
+{
+	return static_cast<unsigned>(workers_.size()) + 1;
+}
+
+Junior::JobSystem& Junior::JobSystem::GetInstance()
+{
+	static JobSystem singleton_;
+	return singleton_;
+}
\ No newline at end of file
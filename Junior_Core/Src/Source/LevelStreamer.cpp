@@ -0,0 +1,333 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: LevelStreamer.cpp
+* Description: Loads and unloads the cells of a level around the main camera, reading their files on the job system's workers
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "LevelStreamer.h"			// Level Streamer
+#include "GameObject.h"				// Game Object
+#include "GameObjectManager.h"		// Game Object Manager
+#include "GameObjectFactory.h"		// Game Object Factory
+#include "Transform.h"				// Transform
+#include "Camera.h"					// Camera
+#include "Graphics.h"				// Graphics
+#include "JobSystem.h"				// Job System
+#include "ActivationSystem.h"		// Activation System
+#include "Parser.h"					// Parser
+#include "Debug.h"					// Debug
+#include <fstream>					// File Stream
+#include <iterator>					// Stream Iterators
+#include <algorithm>				// Sort
+#include <cmath>					// Floor
+#include <cstdlib>					// Absolute Value
+
+// Private Member Functions
+
+Junior::LevelStreamer::LevelStreamer()
+	: levelName_(), cellSize_(1.0f), cells_(), active_(), loadRadius_(1), hysteresis_(1), objectBudget_(static_cast<size_t>(-1)), residentObjects_(0), objectsPerFrame_(64)
+{
+}
+
+long long Junior::LevelStreamer::MakeKey(int x, int y)
+{
+	return static_cast<long long>((static_cast<unsigned long long>(static_cast<unsigned>(x)) << 32) | static_cast<unsigned>(y));
+}
+
+int Junior::LevelStreamer::Distance(const Cell& cell, int x, int y)
+{
+	return std::max(std::abs(cell.info_.x_ - x), std::abs(cell.info_.y_ - y));
+}
+
+Junior::Transform* Junior::LevelStreamer::FindFocus()
+{
+	Camera* camera = Graphics::GetInstance().mainCamera_;
+	if (!camera || !camera->GetOwner())
+	{
+		return nullptr;
+	}
+	return camera->GetOwner()->GetComponent<Transform>();
+}
+
+void Junior::LevelStreamer::StartReading(Cell& cell)
+{
+	std::shared_ptr<FileRead> read = std::make_shared<FileRead>();
+	read->failed_ = false;
+	read->done_ = false;
+	cell.read_ = read;
+	cell.state_ = CELL_READING;
+
+	// Only the file is read on the worker, the objects are created on the main thread since their components touch the graphics
+	std::string path = GameObjectFactory::GetInstance().GetCellFilePath(levelName_, cell.info_.x_, cell.info_.y_);
+	JobSystem::GetInstance().Run([read, path]()
+	{
+		std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+		if (file.is_open())
+		{
+			read->contents_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		}
+		else
+		{
+			read->failed_ = true;
+		}
+		read->done_ = true;
+	});
+}
+
+void Junior::LevelStreamer::StartLoading(Cell& cell)
+{
+	std::string path = GameObjectFactory::GetInstance().GetCellFilePath(levelName_, cell.info_.x_, cell.info_.y_);
+	cell.parser_ = new Parser(path, cell.read_->contents_);
+	cell.read_.reset();
+	cell.state_ = CELL_LOADING;
+	try
+	{
+		cell.parser_->Skip(levelName_ + "_" + std::to_string(cell.info_.x_) + "_" + std::to_string(cell.info_.y_));
+		cell.parser_->Skip("{");
+		cell.parser_->ReadVariable("numGameObjects", cell.remaining_);
+		cell.parser_->Skip("{");
+		cell.objects_.reserve(cell.remaining_);
+	}
+	catch (const ParserException& e)
+	{
+		Debug& debug = Debug::GetInstance();
+		debug.Print(debug.GetDebugLevelName(DebugLevel::ERROR));
+		debug.Print("Failed to load the cell \"" + path + "\": ");
+		debug.PrintLn(e.what());
+		cell.remaining_ = 0;
+	}
+}
+
+void Junior::LevelStreamer::LoadObjects(Cell& cell, unsigned& budget)
+{
+	GameObjectManager& manager = GameObjectManager::GetInstance();
+	try
+	{
+		for (; cell.remaining_ > 0 && budget > 0; --cell.remaining_, --budget)
+		{
+			GameObject* object = GameObjectFactory::GetInstance().ReadObject(*cell.parser_);
+			if (object)
+			{
+				manager.AddObject(object);
+				// Streamed objects with a transform go dormant once they are outside of the region around the camera
+				ActivationSystem::GetInstance().Track(object);
+				cell.objects_.push_back(Handle<GameObject>(object));
+			}
+		}
+	}
+	catch (const ParserException& e)
+	{
+		Debug& debug = Debug::GetInstance();
+		debug.Print(debug.GetDebugLevelName(DebugLevel::ERROR));
+		debug.Print("Failed to load an object of a cell of the level \"" + levelName_ + "\": ");
+		debug.PrintLn(e.what());
+		cell.remaining_ = 0;
+	}
+
+	if (cell.remaining_ == 0)
+	{
+		delete cell.parser_;
+		cell.parser_ = nullptr;
+		cell.state_ = CELL_LOADED;
+	}
+}
+
+void Junior::LevelStreamer::Release(Cell& cell)
+{
+	for (const Handle<GameObject>& handle : cell.objects_)
+	{
+		GameObject* object = handle.Get();
+		if (object)
+		{
+			object->Destroy();
+		}
+	}
+	cell.objects_.clear();
+
+	// A worker still reading the file keeps its own reference, the contents are thrown away when it finishes
+	cell.read_.reset();
+	delete cell.parser_;
+	cell.parser_ = nullptr;
+	cell.remaining_ = 0;
+	cell.state_ = CELL_UNLOADED;
+	residentObjects_ -= cell.info_.numObjects_;
+}
+
+bool Junior::LevelStreamer::EvictFarthest(int x, int y)
+{
+	size_t farthest = active_.size();
+	int farthestDistance = loadRadius_;
+	for (size_t i = 0; i < active_.size(); ++i)
+	{
+		int distance = Distance(cells_[active_[i]], x, y);
+		if (distance > farthestDistance)
+		{
+			farthest = i;
+			farthestDistance = distance;
+		}
+	}
+
+	if (farthest == active_.size())
+	{
+		return false;
+	}
+	Release(cells_[active_[farthest]]);
+	active_[farthest] = active_.back();
+	active_.pop_back();
+	return true;
+}
+
+// Public Member Functions
+
+Junior::LevelStreamer::~LevelStreamer()
+{
+	for (auto& cell : cells_)
+	{
+		delete cell.second.parser_;
+	}
+}
+
+void Junior::LevelStreamer::Open(const std::string& levelName, float cellSize, const std::vector<LevelCell>& cells)
+{
+	Close();
+	levelName_ = levelName;
+	cellSize_ = cellSize;
+	cells_.reserve(cells.size());
+	for (const LevelCell& info : cells)
+	{
+		Cell& cell = cells_[MakeKey(info.x_, info.y_)];
+		cell.info_ = info;
+		cell.state_ = CELL_UNLOADED;
+		cell.parser_ = nullptr;
+		cell.remaining_ = 0;
+	}
+}
+
+void Junior::LevelStreamer::Close()
+{
+	for (long long key : active_)
+	{
+		Release(cells_[key]);
+	}
+	active_.clear();
+	cells_.clear();
+	levelName_.clear();
+	residentObjects_ = 0;
+}
+
+void Junior::LevelStreamer::Update()
+{
+	const Transform* focus = FindFocus();
+	if (!focus || cells_.empty())
+	{
+		return;
+	}
+	Vec3 position = focus->GetGlobalTranslation();
+	int focusX = static_cast<int>(std::floor(position.x_ / cellSize_));
+	int focusY = static_cast<int>(std::floor(position.y_ / cellSize_));
+
+	// Unload the cells that went past the hysteresis, going backwards since unloaded cells leave the list
+	for (size_t i = active_.size(); i > 0; --i)
+	{
+		Cell& cell = cells_[active_[i - 1]];
+		if (Distance(cell, focusX, focusY) > loadRadius_ + hysteresis_)
+		{
+			Release(cell);
+			active_[i - 1] = active_.back();
+			active_.pop_back();
+		}
+	}
+
+	// Only the cells inside of the load radius are looked at, so the cost follows the radius instead of the size of the level
+	std::vector<Cell*> wanted;
+	for (int x = focusX - loadRadius_; x <= focusX + loadRadius_; ++x)
+	{
+		for (int y = focusY - loadRadius_; y <= focusY + loadRadius_; ++y)
+		{
+			auto found = cells_.find(MakeKey(x, y));
+			if (found != cells_.end() && found->second.state_ == CELL_UNLOADED)
+			{
+				wanted.push_back(&found->second);
+			}
+		}
+	}
+
+	// Load the closest cells first, making room in the budget by unloading the cells kept around by the hysteresis
+	std::sort(wanted.begin(), wanted.end(), [focusX, focusY](const Cell* lhs, const Cell* rhs) { return Distance(*lhs, focusX, focusY) < Distance(*rhs, focusX, focusY); });
+	for (Cell* cell : wanted)
+	{
+		while (residentObjects_ + cell->info_.numObjects_ > objectBudget_ && EvictFarthest(focusX, focusY))
+		{
+		}
+		if (residentObjects_ + cell->info_.numObjects_ > objectBudget_)
+		{
+			break;
+		}
+		residentObjects_ += cell->info_.numObjects_;
+		active_.push_back(MakeKey(cell->info_.x_, cell->info_.y_));
+		StartReading(*cell);
+	}
+
+	// Create the objects of the cells that were read, only a few every frame
+	unsigned budget = objectsPerFrame_;
+	for (size_t i = 0; i < active_.size(); ++i)
+	{
+		Cell& cell = cells_[active_[i]];
+		if (cell.state_ == CELL_READING && cell.read_->done_)
+		{
+			if (cell.read_->failed_)
+			{
+				Debug& debug = Debug::GetInstance();
+				debug.Print(debug.GetDebugLevelName(DebugLevel::ERROR));
+				debug.PrintLn("Failed to read a cell of the level \"" + levelName_ + "\"");
+				cell.read_.reset();
+				cell.state_ = CELL_LOADED;
+				continue;
+			}
+			StartLoading(cell);
+		}
+		if (cell.state_ == CELL_LOADING && budget > 0)
+		{
+			LoadObjects(cell, budget);
+		}
+	}
+}
+
+void Junior::LevelStreamer::SetLoadRadius(int radius)
+{
+	loadRadius_ = radius;
+}
+
+void Junior::LevelStreamer::SetHysteresis(int hysteresis)
+{
+	hysteresis_ = hysteresis;
+}
+
+void Junior::LevelStreamer::SetObjectBudget(size_t budget)
+{
+	objectBudget_ = budget;
+}
+
+void Junior::LevelStreamer::SetObjectsPerFrame(unsigned count)
+{
+	objectsPerFrame_ = count;
+}
+
+size_t Junior::LevelStreamer::GetResidentObjectCount() const
+{
+	return residentObjects_;
+}
+
+size_t Junior::LevelStreamer::GetActiveCellCount() const
+{
+	return active_.size();
+}
+
+Junior::LevelStreamer& Junior::LevelStreamer::GetInstance()
+{
+	static LevelStreamer singleton_;
+	return singleton_;
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 * Author: David Wong
 * Email: david.wongcascante@digipen.edu
 * Created: 24-Apr-2018
-* Last Modified: 6-May-2018
+* Last Modified: 17-Oct-2026
 * Description: Write the extra functionality for the linear algebra used in the engine
 * File Name: LinearMath.cpp
 */
@@ -14,6 +14,60 @@
 
 #include "Mat3.h"			// Mat3
 #include "Vec3.h"			// Vec3
+#include "Affine2D.h"		// Affine 2D
+
+#ifdef JUNIOR_MATH_SSE
+// Helper Functions
+
+// Computes the sine and cosine of four angles at once, using the same range reduction and polynomials as the Cephes library
+// Params:
+//	angles: The angles in radians
+//	sine: The sines of the angles
+//	cosine: The cosines of the angles
+static void SineCosine(__m128 angles, __m128& sine, __m128& cosine)
+{
+	const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+	// Work with the absolute value, and remember the sign for the sine
+	__m128 sineSign = _mm_and_ps(angles, signMask);
+	__m128 x = _mm_andnot_ps(signMask, angles);
+
+	// Find the octant of the angle, rounded up to an even number
+	__m128i octant = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+	octant = _mm_and_si128(_mm_add_epi32(octant, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	__m128 y = _mm_cvtepi32_ps(octant);
+
+	// Octants 4 to 7 flip the sine, octants 2, 3, 4 and 5 flip the cosine
+	sineSign = _mm_xor_ps(sineSign, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(octant, _mm_set1_epi32(4)), 29)));
+	__m128 cosineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(octant, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+	// Octants 2, 3, 6 and 7 swap the sine and cosine polynomials
+	__m128 swapMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(octant, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+	// Reduce the angle to [-PI/4, PI/4] in three steps to keep the precision
+	x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+	x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));
+	x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(3.77489497744594108e-8f)));
+	__m128 z = _mm_mul_ps(x, x);
+
+	// Cosine polynomial
+	__m128 cosinePolynomial = _mm_set1_ps(2.443315711809948e-5f);
+	cosinePolynomial = _mm_add_ps(_mm_mul_ps(cosinePolynomial, z), _mm_set1_ps(-1.388731625493765e-3f));
+	cosinePolynomial = _mm_add_ps(_mm_mul_ps(cosinePolynomial, z), _mm_set1_ps(4.166664568298827e-2f));
+	cosinePolynomial = _mm_mul_ps(_mm_mul_ps(cosinePolynomial, z), z);
+	cosinePolynomial = _mm_sub_ps(cosinePolynomial, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+	cosinePolynomial = _mm_add_ps(cosinePolynomial, _mm_set1_ps(1.0f));
+
+	// Sine polynomial
+	__m128 sinePolynomial = _mm_set1_ps(-1.9515295891e-4f);
+	sinePolynomial = _mm_add_ps(_mm_mul_ps(sinePolynomial, z), _mm_set1_ps(8.3321608736e-3f));
+	sinePolynomial = _mm_add_ps(_mm_mul_ps(sinePolynomial, z), _mm_set1_ps(-1.6666654611e-1f));
+	sinePolynomial = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinePolynomial, z), x), x);
+
+	sine = _mm_or_ps(_mm_and_ps(swapMask, sinePolynomial), _mm_andnot_ps(swapMask, cosinePolynomial));
+	cosine = _mm_or_ps(_mm_and_ps(swapMask, cosinePolynomial), _mm_andnot_ps(swapMask, sinePolynomial));
+	sine = _mm_xor_ps(sine, sineSign);
+	cosine = _mm_xor_ps(cosine, cosineSign);
+}
+#endif
 
 // Global Functions //
 
@@ -115,9 +169,121 @@ Junior::Mat3 Junior::Rotation(float angle)
 	};
 }
 
+void Junior::ComposeTransformations(const Vec3* translations, const float* rotations, const Vec3* scalings, Mat3* out, size_t count)
+{
+	// Translation * Rotation * Scale only has these non constant entries
+	// [ cos * sx	-sin * sy	0	tx ]
+	// [ sin * sx	cos * sy	0	ty ]
+	// [ 0			0			sz	tz ]
+	// [ 0			0			0	1  ]
+	size_t i = 0;
+#ifdef JUNIOR_MATH_SSE
+	const __m128 zero = _mm_setzero_ps();
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 sine, cosine;
+		SineCosine(_mm_loadu_ps(rotations + i), sine, cosine);
+
+		// Turn the translations and scalings of four objects into one register per axis
+		__m128 tx = Simd::Load(translations[i + 0]);
+		__m128 ty = Simd::Load(translations[i + 1]);
+		__m128 tz = Simd::Load(translations[i + 2]);
+		__m128 tw = Simd::Load(translations[i + 3]);
+		_MM_TRANSPOSE4_PS(tx, ty, tz, tw);
+		__m128 sx = Simd::Load(scalings[i + 0]);
+		__m128 sy = Simd::Load(scalings[i + 1]);
+		__m128 sz = Simd::Load(scalings[i + 2]);
+		__m128 sw = Simd::Load(scalings[i + 3]);
+		_MM_TRANSPOSE4_PS(sx, sy, sz, sw);
+
+		// Every column of the four matrices, one register per row, then transposed back into one register per matrix
+		__m128 column0[4] = { _mm_mul_ps(cosine, sx), _mm_mul_ps(sine, sx), zero, zero };
+		__m128 column1[4] = { _mm_sub_ps(zero, _mm_mul_ps(sine, sy)), _mm_mul_ps(cosine, sy), zero, zero };
+		__m128 column2[4] = { zero, zero, sz, zero };
+		__m128 column3[4] = { tx, ty, tz, _mm_set1_ps(1.0f) };
+		_MM_TRANSPOSE4_PS(column0[0], column0[1], column0[2], column0[3]);
+		_MM_TRANSPOSE4_PS(column1[0], column1[1], column1[2], column1[3]);
+		_MM_TRANSPOSE4_PS(column2[0], column2[1], column2[2], column2[3]);
+		_MM_TRANSPOSE4_PS(column3[0], column3[1], column3[2], column3[3]);
+		for (unsigned j = 0; j < 4; ++j)
+		{
+			_mm_storeu_ps(out[i + j].m_ + 0, column0[j]);
+			_mm_storeu_ps(out[i + j].m_ + 4, column1[j]);
+			_mm_storeu_ps(out[i + j].m_ + 8, column2[j]);
+			_mm_storeu_ps(out[i + j].m_ + 12, column3[j]);
+		}
+	}
+#endif
+	// Whatever does not fit in a group of four
+	for (; i < count; ++i)
+	{
+		float sine = sinf(rotations[i]);
+		float cosine = cosf(rotations[i]);
+		const Vec3& translation = translations[i];
+		const Vec3& scaling = scalings[i];
+		out[i] =
+		{
+			cosine * scaling.x_,	sine * scaling.x_,		0.0f,			0.0f,
+			-sine * scaling.y_,		cosine * scaling.y_,	0.0f,			0.0f,
+			0.0f,					0.0f,					scaling.z_,		0.0f,
+			translation.x_,			translation.y_,			translation.z_,	1.0f,
+		};
+	}
+}
+
+void Junior::ComposeTransformations(const Vec3* translations, const float* rotations, const Vec3* scalings, Affine2D* out, size_t count)
+{
+	size_t i = 0;
+#ifdef JUNIOR_MATH_SSE
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 sine, cosine;
+		SineCosine(_mm_loadu_ps(rotations + i), sine, cosine);
+
+		// Only x and y are needed, so the four objects are gathered one axis at a time
+		__m128 tx = _mm_setr_ps(translations[i].x_, translations[i + 1].x_, translations[i + 2].x_, translations[i + 3].x_);
+		__m128 ty = _mm_setr_ps(translations[i].y_, translations[i + 1].y_, translations[i + 2].y_, translations[i + 3].y_);
+		__m128 sx = _mm_setr_ps(scalings[i].x_, scalings[i + 1].x_, scalings[i + 2].x_, scalings[i + 3].x_);
+		__m128 sy = _mm_setr_ps(scalings[i].y_, scalings[i + 1].y_, scalings[i + 2].y_, scalings[i + 3].y_);
+
+		// One array per entry of the transformations, then scattered into the four objects
+		float entries[6][4];
+		_mm_storeu_ps(entries[0], _mm_mul_ps(cosine, sx));
+		_mm_storeu_ps(entries[1], _mm_mul_ps(sine, sx));
+		_mm_storeu_ps(entries[2], _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(sine, sy)));
+		_mm_storeu_ps(entries[3], _mm_mul_ps(cosine, sy));
+		_mm_storeu_ps(entries[4], tx);
+		_mm_storeu_ps(entries[5], ty);
+		for (unsigned j = 0; j < 4; ++j)
+		{
+			for (unsigned k = 0; k < 6; ++k)
+			{
+				out[i + j].m_[k] = entries[k][j];
+			}
+		}
+	}
+#endif
+	// Whatever does not fit in a group of four
+	for (; i < count; ++i)
+	{
+		out[i] = AffineCompose(translations[i], rotations[i], scalings[i]);
+	}
+}
+
 Junior::Mat3 Junior::Transpose(const Junior::Mat3& mat)
 {
 	Mat3 copy;
+#ifdef JUNIOR_MATH_SSE
+	__m128 column0 = _mm_loadu_ps(mat.m_ + 0);
+	__m128 column1 = _mm_loadu_ps(mat.m_ + 4);
+	__m128 column2 = _mm_loadu_ps(mat.m_ + 8);
+	__m128 column3 = _mm_loadu_ps(mat.m_ + 12);
+	_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+	_mm_storeu_ps(copy.m_ + 0, column0);
+	_mm_storeu_ps(copy.m_ + 4, column1);
+	_mm_storeu_ps(copy.m_ + 8, column2);
+	_mm_storeu_ps(copy.m_ + 12, column3);
+#else
 	for (unsigned i = 0; i < 4; ++i)
 	{
 		for (unsigned j = 0; j < 4; ++j)
@@ -125,6 +291,7 @@ Junior::Mat3 Junior::Transpose(const Junior::Mat3& mat)
 			copy.m_[j * 4 + i] = mat.m_[i * 4 + j];
 		}
 	}
+#endif
 	return copy;
 }
 
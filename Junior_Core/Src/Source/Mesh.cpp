@@ -5,12 +5,13 @@
  * Description: Meshes hold the data to render generic data to render sprites into the screen
 				as well as custom data
  * Created: 1 May 2019
- * Last Modified: 2 May 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include "Mesh.h"
 #include "OpenGLBundle.h"		// OpenGL Bundle
+#include "RenderQueue.h"		// Render Queue
 
 // Private Member Functions
 
@@ -118,24 +119,25 @@ Junior::BasicData::BasicData(const BasicData& other)
 }
 
 Junior::Mesh::Mesh(const std::string& name)
-	: basicData_(), name_(name), meshVertexArray_(0), meshBasicBuffer_(0)
+	: basicData_(), name_(name), meshVertexArray_(0), meshBasicBuffer_(0), layer_(0)
 {
 	SetUpInitialData();
 }
 
 Junior::Mesh::Mesh(const Mesh& other)
-	: name_(other.name_), basicData_(other.basicData_), meshVertexArray_(other.meshVertexArray_), meshBasicBuffer_(other.meshBasicBuffer_)
+	: name_(other.name_), basicData_(other.basicData_), meshVertexArray_(other.meshVertexArray_), meshBasicBuffer_(other.meshBasicBuffer_),
+	layer_(other.layer_)
 {
 }
 
 Junior::Mesh::Mesh(const std::string& name, unsigned count, const float* vertices, const float* textureCoordinates)
-	: basicData_(count, vertices, textureCoordinates), name_(name), meshVertexArray_(0), meshBasicBuffer_(0)
+	: basicData_(count, vertices, textureCoordinates), name_(name), meshVertexArray_(0), meshBasicBuffer_(0), layer_(0)
 {
 	SetUpInitialData();
 }
 
 Junior::Mesh::Mesh(const std::string& name, const BasicData& other)
-	: basicData_(other), name_(name), meshVertexArray_(0), meshBasicBuffer_(0)
+	: basicData_(other), name_(name), meshVertexArray_(0), meshBasicBuffer_(0), layer_(0)
 {
 	SetUpInitialData();
 }
@@ -170,6 +172,30 @@ void Junior::Mesh::Draw(unsigned)
 	glDrawArrays(GL_TRIANGLE_STRIP, 0, static_cast<unsigned>(basicData_.data_.size() / 5));
 }
 
+void Junior::Mesh::Submit(RenderQueue& queue)
+{
+	queue.Push(this, layer_, 0, 0.0f, 0);
+}
+
+void Junior::Mesh::BindTexture(const RenderCommand&, unsigned)
+{
+}
+
+void Junior::Mesh::DrawCommand(const RenderCommand&, unsigned shaderID)
+{
+	Draw(shaderID);
+}
+
+void Junior::Mesh::SetLayer(unsigned layer)
+{
+	layer_ = layer;
+}
+
+unsigned Junior::Mesh::GetLayer() const
+{
+	return layer_;
+}
+
 void Junior::Mesh::SetName(const std::string& name)
 {
 	name_ = name;
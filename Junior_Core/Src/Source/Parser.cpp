@@ -4,7 +4,7 @@
 * File name: Parser.cpp
 * Description: Parses through a text file
 * Created: 27-Mar-2019
-* Last Modified: 27-Mar-2019
+* Last Modified: 17-Oct-2026
 */
 
 // Includes
@@ -16,18 +16,24 @@ Junior::ParserException::ParserException(const std::string& fileName, const std:
 }
 
 Junior::Parser::Parser()
+	: stream_(&file_)
 {
 }
 
 Junior::Parser::Parser(const std::string& fileName, std::fstream::openmode mode)
-	: file_(), fileName_(fileName), tab_("   "), numTabs_(0)
+	: file_(), memory_(), stream_(&file_), fileName_(fileName), tab_("   "), numTabs_(0)
 {
 	Resource::LoadFromDisk(fileName);
 	file_.open(fileName, mode);
 }
 
+Junior::Parser::Parser(const std::string& fileName, const std::string& contents)
+	: file_(), memory_(contents, std::ios_base::in), stream_(&memory_), fileName_(fileName), tab_("   "), numTabs_(0)
+{
+}
+
 Junior::Parser::Parser(Parser& other)
-	: file_(), fileName_(other.fileName_)
+	: file_(), memory_(), stream_(&file_), fileName_(other.fileName_)
 {
 }
 
@@ -53,21 +59,22 @@ void Junior::Parser::Open(std::fstream::openmode  mode)
 
 void Junior::Parser::CheckIfOpen() const
 {
-	if(!file_.is_open())
+	// Text in memory is always open
+	if(stream_ == &file_ && !file_.is_open())
 		throw ParserException(fileName_, "File failed to open!");
 }
 
 std::string Junior::Parser::GetLine(unsigned length)
 {
 	char* rawData = nullptr;
-	file_.getline(rawData, length);
+	stream_->getline(rawData, length);
 	std::string line(rawData);
 	return line;
 }
 
 void Junior::Parser::Skip(char skip)
 {
-	file_.ignore(skip, 10);
+	stream_->ignore(skip, 10);
 }
 
 void Junior::Parser::Skip(const std::string& skip)
@@ -75,7 +82,7 @@ void Junior::Parser::Skip(const std::string& skip)
 	CheckIfOpen();
 
 	std::string word;
-	file_ >> word;
+	*stream_ >> word;
 
 	//If the contents of the string don't match the name parameter, throw a ParseException with the file name and a message about how a variable with the given name could not be found.
 	if (word != skip) {
@@ -85,15 +92,15 @@ void Junior::Parser::Skip(const std::string& skip)
 
 void Junior::Parser::Peek(char& character)
 {
-	character = file_.peek();
+	character = stream_->peek();
 }
 
 void Junior::Parser::StarScope()
 {
 	CheckIfOpen();
 	for (unsigned i = 0; i < numTabs_; ++i)
-		file_ << tab_;
-	file_ << '{' << std::endl;
+		*stream_ << tab_;
+	*stream_ << '{' << std::endl;
 	++numTabs_;
 }
 
@@ -102,16 +109,16 @@ void Junior::Parser::EndScope()
 	CheckIfOpen();
 	--numTabs_;
 	for (unsigned i = 0; i < numTabs_; ++i)
-		file_ << tab_;
-	file_ << '}' << std::endl;
+		*stream_ << tab_;
+	*stream_ << '}' << std::endl;
 }
 
 void Junior::Parser::Reset()
 {
 	CheckIfOpen();
 	// Reset the file seeker
-	file_.clear();
-	file_.seekg(0, std::ios::beg);
+	stream_->clear();
+	stream_->seekg(0, std::ios::beg);
 	// Reset the tabs
 	numTabs_ = 0;
 }
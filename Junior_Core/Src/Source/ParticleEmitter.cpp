@@ -4,7 +4,7 @@
 * File name: ParticleEmitter.cpp
 * Description: Emits the particles
 * Created: 6 May 2018
-* Last Modified: 10 May 2019
+* Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -28,13 +28,23 @@ float Junior::Lerp(const float& start, const float& end, float t)
 	return start + t * (end - start);
 }
 
+// Public Structures
+
+Junior::ParticleEmitter::Settings::Settings()
+	: colorInterpolate_(Lerp), sizeInterpolate_(Lerp), startColor_(), endColor_(), initialVelocity_(0, 0, 0), startAcceleration_(0, 0, 0),
+	startSize_(20), endingSize_(50), maxParticles_(0), particleSpawnCount_(0), maxLifeTime_(0), minLifeTime_(0), particleSpawnWait_(0),
+	loop_(false), randomVelocityAngle_(0)
+{
+}
+
 // Private Member Functions
 
 void Junior::ParticleEmitter::SpawnParticles()
 {
+	const Settings& settings = settings_.Read();
 	// Spawn particles by updating data on dead particles
 	// -> Find each dead particle that is not past the vector's range
-	for (size_t i = 0; i < particleSpawnCount_; ++i)
+	for (size_t i = 0; i < settings.particleSpawnCount_; ++i)
 	{
 		// If the index is outside of the range of the vector, then quit spawning particles
 		if (numParticles_ >= particles_.size())
@@ -43,20 +53,20 @@ void Junior::ParticleEmitter::SpawnParticles()
 		// Otherwise, update the data
 		Particle& particle = particles_.at(numParticles_);
 		// The random angle to rotate the intial velocity
-		float randVelAngle = random_.RandomFloat(-randomVelocityAngle_ / 2.0f, randomVelocityAngle_ / 2.0f);
+		float randVelAngle = random_.RandomFloat(-settings.randomVelocityAngle_ / 2.0f, settings.randomVelocityAngle_ / 2.0f);
 		// Find the random velocity that we will spawn these particles at
 		Vec3 rotatedVelocity = Vec3(
-									initialVelocity_.x_ * cosf(randVelAngle * static_cast<float>(DEG_TO_RAD)) - 
-														initialVelocity_.y_ * sinf(randVelAngle * static_cast<float>(DEG_TO_RAD)), 
-									initialVelocity_.y_ * cosf(randVelAngle * static_cast<float>(DEG_TO_RAD)) + 
-														initialVelocity_.x_ * sinf(randVelAngle * static_cast<float>(DEG_TO_RAD))
+									settings.initialVelocity_.x_ * cosf(randVelAngle * static_cast<float>(DEG_TO_RAD)) - 
+														settings.initialVelocity_.y_ * sinf(randVelAngle * static_cast<float>(DEG_TO_RAD)), 
+									settings.initialVelocity_.y_ * cosf(randVelAngle * static_cast<float>(DEG_TO_RAD)) + 
+														settings.initialVelocity_.x_ * sinf(randVelAngle * static_cast<float>(DEG_TO_RAD))
 								);
 		// Source: https://stackoverflow.com/questions/686353/random-float-number-generation
-		particle.lifeTime_ = particle.age_ = random_.RandomFloat(minLifeTime_, maxLifeTime_);
+		particle.lifeTime_ = particle.age_ = random_.RandomFloat(settings.minLifeTime_, settings.maxLifeTime_);
 		particle.velocity_ = rotatedVelocity;
-		particle.acceleration_ = startAcceleration_;
-		particle.color_ = startColor_;
-		particle.size_ = startSize_;
+		particle.acceleration_ = settings.startAcceleration_;
+		particle.color_ = settings.startColor_;
+		particle.size_ = settings.startSize_;
 		particle.position_ = transform_->GetGlobalTranslation();
 		++numParticles_;
 	}
@@ -65,20 +75,12 @@ void Junior::ParticleEmitter::SpawnParticles()
 // Public Member Functions
 
 Junior::ParticleEmitter::ParticleEmitter()
-	: particleSpawnTimer_(0.0f), maxLifeTime_(0), minLifeTime_(0), initialVelocity_(0, 0, 0), randomVelocityAngle_(0),
-	  maxParticles_(0), numParticles_(0), particleSpawnCount_(0), particleSpawnWait_(0), loop_(false), particles_(),
-	  startAcceleration_(0, 0, 0),
-	  startSize_(20), endingSize_(50), colorInterpolate_(Lerp), sizeInterpolate_(Lerp), random_(), textureAtlas_(0)
+	: particles_(), particleSpawnTimer_(0.0f), numParticles_(0), random_(), settings_(), textureAtlas_(0)
 {
 }
 
 Junior::ParticleEmitter::ParticleEmitter(const ParticleEmitter& other)
-	: particleSpawnCount_(other.particleSpawnCount_), maxLifeTime_(other.maxLifeTime_), minLifeTime_(other.minLifeTime_),
-	maxParticles_(other.maxParticles_), numParticles_(other.numParticles_), particleSpawnWait_(other.particleSpawnWait_),
-	startSize_(other.startSize_), endingSize_(other.endingSize_), initialVelocity_(other.initialVelocity_),
-	randomVelocityAngle_(other.randomVelocityAngle_), particleSpawnTimer_(0.0f), loop_(other.loop_), random_(), textureAtlas_(0),
-	startAcceleration_(other.startAcceleration_), startColor_(other.startColor_), endColor_(other.endColor_),
-	particles_(), colorInterpolate_(other.colorInterpolate_), sizeInterpolate_(other.sizeInterpolate_)
+	: particles_(), particleSpawnTimer_(0.0f), numParticles_(other.numParticles_), random_(), settings_(other.settings_), textureAtlas_(0)
 {
 }
 
@@ -88,7 +90,7 @@ void Junior::ParticleEmitter::Initialize()
 	transform_ = owner_->GetComponent<Transform>();
 	// Reset the particles
 	particles_.clear();
-	particles_.resize(maxParticles_);
+	particles_.resize(settings_.Read().maxParticles_);
 	// Reset the spawn timer
 	particleSpawnTimer_ = 0.0f;
 	// Seed the random number generator
@@ -99,11 +101,12 @@ void Junior::ParticleEmitter::Initialize()
 
 void Junior::ParticleEmitter::Update(double dt)
 {
+	const Settings& settings = settings_.Read();
 	// Check if we need to spawn any particles
 	particleSpawnTimer_ += static_cast<float>(dt);
-	if (particleSpawnTimer_ >= particleSpawnWait_ && loop_)
+	if (particleSpawnTimer_ >= settings.particleSpawnWait_ && settings.loop_)
 	{
-		particleSpawnTimer_ -= particleSpawnWait_;
+		particleSpawnTimer_ -= settings.particleSpawnWait_;
 		// Start spawning particles
 		SpawnParticles();
 	}
@@ -138,9 +141,9 @@ void Junior::ParticleEmitter::Update(double dt)
 			// Update the current position
 			current.position_ += current.velocity_ * static_cast<float>(dt);
 			// Change the color of the particle
-			current.color_ = colorInterpolate_(startColor_, endColor_, 1 - (current.age_ / current.lifeTime_));
+			current.color_ = settings.colorInterpolate_(settings.startColor_, settings.endColor_, 1 - (current.age_ / current.lifeTime_));
 			// Change the size of the particle
-			current.size_ = sizeInterpolate_(startSize_, endingSize_, 1 - (current.age_ / current.lifeTime_));
+			current.size_ = settings.sizeInterpolate_(settings.startSize_, settings.endingSize_, 1 - (current.age_ / current.lifeTime_));
 
 			++particle;
 		}
@@ -154,36 +157,38 @@ void Junior::ParticleEmitter::Unload()
 
 void Junior::ParticleEmitter::Serialize(Parser& parser) const
 {
-	parser.WriteVariable("maxLifetime", maxLifeTime_);
-	parser.WriteVariable("minLifetime", minLifeTime_);
-	parser.WriteVariable("maxParticles", maxParticles_);
-	parser.WriteVariable("particleSpawnCount", particleSpawnCount_);
-	parser.WriteVariable("particleSpawnWait", particleSpawnWait_);
-	parser.WriteVariable("startColor", startColor_);
-	parser.WriteVariable("endColor", endColor_);
-	parser.WriteVariable("startSize", startSize_);
-	parser.WriteVariable("endingSize", endingSize_);
-	parser.WriteVariable("initialVelocity", initialVelocity_);
-	parser.WriteVariable("randomVelocityAngle", randomVelocityAngle_);
-	parser.WriteVariable("startAcceleration", startAcceleration_);
-	parser.WriteVariable("loop", loop_);
+	const Settings& settings = settings_.Read();
+	parser.WriteVariable("maxLifetime", settings.maxLifeTime_);
+	parser.WriteVariable("minLifetime", settings.minLifeTime_);
+	parser.WriteVariable("maxParticles", settings.maxParticles_);
+	parser.WriteVariable("particleSpawnCount", settings.particleSpawnCount_);
+	parser.WriteVariable("particleSpawnWait", settings.particleSpawnWait_);
+	parser.WriteVariable("startColor", settings.startColor_);
+	parser.WriteVariable("endColor", settings.endColor_);
+	parser.WriteVariable("startSize", settings.startSize_);
+	parser.WriteVariable("endingSize", settings.endingSize_);
+	parser.WriteVariable("initialVelocity", settings.initialVelocity_);
+	parser.WriteVariable("randomVelocityAngle", settings.randomVelocityAngle_);
+	parser.WriteVariable("startAcceleration", settings.startAcceleration_);
+	parser.WriteVariable("loop", settings.loop_);
 }
 
 void Junior::ParticleEmitter::Deserialize(Parser& parser)
 {
-	parser.ReadVariable("maxLifetime", maxLifeTime_);
-	parser.ReadVariable("minLifetime", minLifeTime_);
-	parser.ReadVariable("maxParticles", maxParticles_);
-	parser.ReadVariable("particleSpawnCount", particleSpawnCount_);
-	parser.ReadVariable("particleSpawnWait", particleSpawnWait_);
-	parser.ReadVariable("startColor", startColor_);
-	parser.ReadVariable("endColor", endColor_);
-	parser.ReadVariable("startSize", startSize_);
-	parser.ReadVariable("endingSize", endingSize_);
-	parser.ReadVariable("initialVelocity", initialVelocity_);
-	parser.ReadVariable("randomVelocityAngle", randomVelocityAngle_);
-	parser.ReadVariable("startAcceleration", startAcceleration_);
-	parser.ReadVariable("loop", loop_);
+	Settings& settings = settings_.Write();
+	parser.ReadVariable("maxLifetime", settings.maxLifeTime_);
+	parser.ReadVariable("minLifetime", settings.minLifeTime_);
+	parser.ReadVariable("maxParticles", settings.maxParticles_);
+	parser.ReadVariable("particleSpawnCount", settings.particleSpawnCount_);
+	parser.ReadVariable("particleSpawnWait", settings.particleSpawnWait_);
+	parser.ReadVariable("startColor", settings.startColor_);
+	parser.ReadVariable("endColor", settings.endColor_);
+	parser.ReadVariable("startSize", settings.startSize_);
+	parser.ReadVariable("endingSize", settings.endingSize_);
+	parser.ReadVariable("initialVelocity", settings.initialVelocity_);
+	parser.ReadVariable("randomVelocityAngle", settings.randomVelocityAngle_);
+	parser.ReadVariable("startAcceleration", settings.startAcceleration_);
+	parser.ReadVariable("loop", settings.loop_);
 }
 
 std::vector<Junior::Particle>& Junior::ParticleEmitter::GetParticleList()
@@ -194,4 +199,14 @@ std::vector<Junior::Particle>& Junior::ParticleEmitter::GetParticleList()
 unsigned Junior::ParticleEmitter::GetNumParticlesAlive() const
 {
 	return numParticles_;
+}
+
+const Junior::ParticleEmitter::Settings& Junior::ParticleEmitter::GetSettings() const
+{
+	return settings_.Read();
+}
+
+Junior::ParticleEmitter::Settings& Junior::ParticleEmitter::EditSettings()
+{
+	return settings_.Write();
 }
\ No newline at end of file
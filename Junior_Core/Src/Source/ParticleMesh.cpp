@@ -4,16 +4,54 @@
  * File name: ParticleMesh.cpp
  * Description: The mesh we are using to render the particles
  * Created: 10 May 2019
- * Last Modified: 3 Sep 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
 #include "ParticleMesh.h"
 #include "OpenGLBundle.h"			// OpenGL Functions
 #include "ParticleEmitter.h"		// Get the particle emitter
+#include "CullingVolume.h"			// Culling Volume
+#include "Graphics.h"				// Main Camera
+#include "Camera.h"					// Camera Matrix
+#include "LinearMath.h"				// Identity
+#include "Transform.h"				// Emitter Depth
+#include "RenderQueue.h"			// Render Queue
+
+// Private Member Functions
+
+void Junior::ParticleMesh::DrawEmitter(ParticleEmitter* emitter, const CullingVolume& volume)
+{
+	// If all of the particles are indeed dead, then don't draw the particle list
+	unsigned numAlive = emitter->GetNumParticlesAlive();
+	if (numAlive == 0)
+		return;
+
+	// Only the particles on screen are sent to the GPU
+	const std::vector<Particle>& particles = emitter->GetParticleList();
+	visibleParticles_.clear();
+	for (unsigned i = 0; i < numAlive; ++i)
+	{
+		if (volume.IsSquareVisible(particles[i].position_, particles[i].size_))
+		{
+			visibleParticles_.push_back(particles[i]);
+		}
+	}
+	drawnCount_ += visibleParticles_.size();
+	culledCount_ += numAlive - visibleParticles_.size();
+	if (visibleParticles_.empty())
+		return;
+
+	glBindBuffer(GL_ARRAY_BUFFER, particleBuffer_);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(Particle) * visibleParticles_.size(), visibleParticles_.data(), GL_STREAM_DRAW);
+	// And DRAW
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(visibleParticles_.size()));
+}
+
+// Public Member Functions
 
 Junior::ParticleMesh::ParticleMesh()
-	: Mesh("ParticleMesh", CreateQuadMeshData()), particleBuffer_(0), numParticleAttribs_(6)
+	: Mesh("ParticleMesh", CreateQuadMeshData()), numParticleAttribs_(6), emitterParticleList_(), emitterVisible_(), particleBuffer_(0), visibleParticles_(), drawnCount_(0), culledCount_(0), cullingVolume_(Identity())
 {
 	// Create the buffer for all the particle data
 	glGenBuffers(1, &particleBuffer_);
@@ -59,49 +97,65 @@ Junior::ParticleMesh::~ParticleMesh()
 	glDeleteBuffers(1, &particleBuffer_);
 }
 
-void Junior::ParticleMesh::Draw(unsigned shaderID)
+void Junior::ParticleMesh::Submit(RenderQueue& queue)
 {
-	// Bind the mesh we are about to draw
-	StartBinding();
+	drawnCount_ = 0;
+	culledCount_ = 0;
+	// Without a camera the shaders draw in clip space as it is
+	Camera* camera = Graphics::GetInstance().mainCamera_;
+	cullingVolume_ = CullingVolume(camera ? camera->GetCameraMatrix() : Identity());
 
-	// Enable the vertex buffers' attributes
-	SetBasicVertexAttribsEnabled(true);
-	for (size_t i = 0; i < numParticleAttribs_; ++i)
+	// Every emitter is its own command, so emitters sharing an atlas are drawn together
+	// The atlas sits above the depth in the sort key, so the depth only orders the emitters of the same atlas back to front
+	for (size_t i = 0; i < emitterParticleList_.size(); ++i)
 	{
-		glEnableVertexAttribArray(static_cast<GLsizei>(i + Mesh::ATTRIBUTE_START_INDEX));
-	}
-
-	// Start drawing the particles, list by list
-	for (auto currEmitter = emitterParticleList_.begin(); currEmitter != emitterParticleList_.end(); ++currEmitter)
-	{
-		// Prepare an array to send to the GPU
-		std::vector<Particle> particleData = (*currEmitter)->GetParticleList();
-		// If all of the particles are indeed dead, then don't draw the particle list
-		if ((*currEmitter)->GetNumParticlesAlive() == 0)
+		ParticleEmitter* emitter = emitterParticleList_[i];
+		if (!emitterVisible_[i] || emitter->GetNumParticlesAlive() == 0)
 			continue;
 
-		glBindBuffer(GL_ARRAY_BUFFER, particleBuffer_);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(Particle) * (*currEmitter)->GetNumParticlesAlive(), particleData.data(), GL_STREAM_DRAW);
-		// Set the uniform for the texture atlas
-		GLuint atlasID = glGetUniformLocation(shaderID, "textureAtlas");
-		glUniform1i(atlasID, (*currEmitter)->textureAtlas_);
-		// And DRAW
-		glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>((*currEmitter)->GetNumParticlesAlive()));
+		float depth = emitter->transform_ ? emitter->transform_->GetGlobalTranslation().z_ : 0.0f;
+		queue.Push(this, GetLayer(), emitter->textureAtlas_, depth, static_cast<unsigned>(i));
 	}
+}
 
-	// Disable the vertex buffers' attributes
-	SetBasicVertexAttribsEnabled(false);
-	for (size_t i = 0; i < numParticleAttribs_; ++i)
-	{
-		glDisableVertexAttribArray(static_cast<GLsizei>(i + Mesh::ATTRIBUTE_START_INDEX));
-	}
-	// Unbind the mesh we are about to draw
-	glBindBuffer(GL_ARRAY_BUFFER, particleBuffer_);
-	EndBinding();
+void Junior::ParticleMesh::BindTexture(const RenderCommand& command, unsigned shaderID)
+{
+	// Set the uniform for the texture atlas
+	GLuint atlasID = glGetUniformLocation(shaderID, "textureAtlas");
+	glUniform1i(atlasID, command.texture_);
+}
+
+void Junior::ParticleMesh::DrawCommand(const RenderCommand& command, unsigned)
+{
+	// The attributes were enabled in the vertex array object when the mesh was made, so binding the mesh is enough
+	DrawEmitter(emitterParticleList_[command.index_], cullingVolume_);
 }
 
 void Junior::ParticleMesh::AddList(ParticleEmitter* emitter)
 {
 	// Add the emitter to the list
 	emitterParticleList_.push_back(emitter);
+	emitterVisible_.push_back(true);
+}
+
+void Junior::ParticleMesh::SetEmitterVisible(const ParticleEmitter* emitter, bool visible)
+{
+	for (size_t i = 0; i < emitterParticleList_.size(); ++i)
+	{
+		if (emitterParticleList_[i] == emitter)
+		{
+			emitterVisible_[i] = visible;
+			return;
+		}
+	}
+}
+
+size_t Junior::ParticleMesh::GetDrawnParticleCount() const
+{
+	return drawnCount_;
+}
+
+size_t Junior::ParticleMesh::GetCulledParticleCount() const
+{
+	return culledCount_;
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
  * File name: ParticleMeshLink.cpp
  * Description: The mesh link used to send rendering data to the particle mesh
  * Created: 10 May 2019
- * Last Modified: 25 May 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Incldudes
@@ -18,12 +18,12 @@
 // Public Member Functions
 
 Junior::ParticleMeshLink::ParticleMeshLink()
-	: emitter_(nullptr), shaderDir_("..//Assets//Shaders//particle")
+	: shaderDir_("..//Assets//Shaders//particle"), emitter_(nullptr), sprite_()
 {
 }
 
 Junior::ParticleMeshLink::ParticleMeshLink(const ParticleMeshLink& other)
-	: emitter_(nullptr), shaderDir_("..//Assets//Shaders//particle")
+	: shaderDir_("..//Assets//Shaders//particle"), emitter_(nullptr), sprite_()
 {
 }
 
@@ -39,7 +39,7 @@ void Junior::ParticleMeshLink::Initialize()
 		emitter_->textureAtlas_ = sprite_->GetAtlasID();
 		// Send the data to the Particle Mesh
 		ParticleMesh* particleMesh = Graphics::GetInstance().GetMesh<ParticleMesh>(shaderDir_);
-		particleMesh->AddList(emitter_);
+		particleMesh->AddList(emitter_.Get());
 	}
 }
 
@@ -66,4 +66,29 @@ void Junior::ParticleMeshLink::Update(double dt)
 
 void Junior::ParticleMeshLink::Unload()
 {
+}
+
+void Junior::ParticleMeshLink::Sleep()
+{
+	if (emitter_)
+	{
+		Graphics::GetInstance().GetMesh<ParticleMesh>(shaderDir_)->SetEmitterVisible(emitter_.Get(), false);
+	}
+}
+
+void Junior::ParticleMeshLink::Wake()
+{
+	if (emitter_)
+	{
+		Graphics::GetInstance().GetMesh<ParticleMesh>(shaderDir_)->SetEmitterVisible(emitter_.Get(), true);
+	}
+}
+
+// Public Static Functions
+
+void Junior::ParticleMeshLink::DeclareAccess(ComponentAccess& access)
+{
+	// The particles of the emitter receive the sprite's texture coordinates
+	access.Reads<Sprite>();
+	access.Writes<ParticleEmitter>();
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
  * File name: Physics.cpp
  * Description: Takes care of any physical motion
  * Created: 7 Jul 2019
- * Last Modified: 18 Jul 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -99,4 +99,12 @@ float Junior::Physics::GetAngularVelocity() const
 const Junior::Vec3& Junior::Physics::GetPrevPosition() const
 {
 	return prevPosition_;
+}
+
+// Public Static Functions
+
+void Junior::Physics::DeclareAccess(ComponentAccess& access)
+{
+	// Physics moves the object's transform
+	access.Writes<Transform>();
 }
\ No newline at end of file
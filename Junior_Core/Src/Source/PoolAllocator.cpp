@@ -0,0 +1,116 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: PoolAllocator.cpp
+* Description: Hands out fixed size blocks carved from larger slabs, keeping the freed blocks in a list to be reused
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "PoolAllocator.h"		// Pool Allocator
+#include <new>					// Operator New
+#include <cstdint>				// Uintptr_t
+
+// Private Member Functions
+
+void Junior::PoolAllocator::AddSlab()
+{
+	// Leave room to align the first block, the rest follow since the block size is a multiple of the alignment
+	unsigned char* memory = static_cast<unsigned char*>(::operator new(blockSize_ * blocksPerSlab_ + alignment_));
+	slabs_.push_back(memory);
+	uintptr_t address = reinterpret_cast<uintptr_t>(memory);
+	unsigned char* first = memory + ((alignment_ - address % alignment_) % alignment_);
+
+	// Link the blocks backwards so they are handed out in the order of their addresses
+	for (size_t i = blocksPerSlab_; i > 0; --i)
+	{
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(first + (i - 1) * blockSize_);
+		block->next_ = freeList_;
+		freeList_ = block;
+	}
+	freeBlocks_ += blocksPerSlab_;
+}
+
+// Public Member Functions
+
+Junior::PoolAllocator::PoolAllocator(size_t blockSize, size_t alignment, size_t blocksPerSlab)
+	: blockSize_(blockSize), alignment_(alignment), blocksPerSlab_(blocksPerSlab), slabs_(), freeList_(nullptr), liveBlocks_(0), freeBlocks_(0)
+{
+	// Every block has to fit the free list's link
+	if (alignment_ < alignof(FreeBlock))
+	{
+		alignment_ = alignof(FreeBlock);
+	}
+	if (blockSize_ < sizeof(FreeBlock))
+	{
+		blockSize_ = sizeof(FreeBlock);
+	}
+	blockSize_ = (blockSize_ + alignment_ - 1) / alignment_ * alignment_;
+	if (blocksPerSlab_ == 0)
+	{
+		blocksPerSlab_ = 1;
+	}
+}
+
+Junior::PoolAllocator::~PoolAllocator()
+{
+	// Blocks still in use at exit keep their memory, so releasing them late does not touch freed slabs
+	if (liveBlocks_ != 0)
+	{
+		return;
+	}
+	for (void* slab : slabs_)
+	{
+		::operator delete(slab);
+	}
+}
+
+void* Junior::PoolAllocator::Allocate()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (!freeList_)
+	{
+		AddSlab();
+	}
+	FreeBlock* block = freeList_;
+	freeList_ = block->next_;
+	--freeBlocks_;
+	++liveBlocks_;
+	return block;
+}
+
+void Junior::PoolAllocator::Free(void* block)
+{
+	if (!block)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	FreeBlock* freed = static_cast<FreeBlock*>(block);
+	freed->next_ = freeList_;
+	freeList_ = freed;
+	++freeBlocks_;
+	--liveBlocks_;
+}
+
+size_t Junior::PoolAllocator::GetBlockSize() const
+{
+	return blockSize_;
+}
+
+size_t Junior::PoolAllocator::GetLiveCount() const
+{
+	return liveBlocks_;
+}
+
+size_t Junior::PoolAllocator::GetFreeCount() const
+{
+	return freeBlocks_;
+}
+
+size_t Junior::PoolAllocator::GetSlabCount() const
+{
+	return slabs_.size();
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: RenderQueue.cpp
+* Description: Collects the draw commands of every mesh each frame and sorts them, so they are drawn in order while changing as little OpenGL state as possible
+* Created: 17-Oct-2026
+* Last Modified: 17-Oct-2026
+*/
+
+// Includes //
+#include "RenderQueue.h"
+#include <cstring>				// Memory Copy
+#include "OpenGLBundle.h"		// OpenGL
+#include "DrawProgram.h"		// Draw Program
+#include "Mesh.h"				// Mesh
+#include "Texture.h"			// Texture
+#include "Mat3.h"				// Mat3
+
+// Public Member Functions //
+
+Junior::RenderQueue::RenderQueue()
+	: commands_(), sortBuffer_(), program_(nullptr), programOrder_(0), programChanges_(0), meshChanges_(0), textureChanges_(0), drawCount_(0)
+{
+}
+
+void Junior::RenderQueue::Clear()
+{
+	commands_.clear();
+	program_ = nullptr;
+	programOrder_ = 0;
+}
+
+void Junior::RenderQueue::BeginProgram(DrawProgram* program, unsigned order)
+{
+	program_ = program;
+	programOrder_ = order;
+}
+
+void Junior::RenderQueue::Push(Mesh* mesh, unsigned layer, unsigned texture, float depth, unsigned index)
+{
+	// Flipping the bits of a float makes its bits sort the same way the float does, negative numbers included
+	uint32_t depthBits;
+	std::memcpy(&depthBits, &depth, sizeof(depthBits));
+	depthBits = (depthBits & 0x80000000u) ? ~depthBits : (depthBits | 0x80000000u);
+
+	// Anything too big for its part of the key is clamped, so it can not spill into the parts above it
+	uint64_t layerPart = layer < (1u << LAYER_BITS) ? layer : (1u << LAYER_BITS) - 1;
+	uint64_t programPart = programOrder_ < (1u << PROGRAM_BITS) ? programOrder_ : (1u << PROGRAM_BITS) - 1;
+	uint64_t texturePart = texture < (1u << TEXTURE_BITS) ? texture : (1u << TEXTURE_BITS) - 1;
+
+	RenderCommand command;
+	command.key_ = (layerPart << (PROGRAM_BITS + TEXTURE_BITS + DEPTH_BITS)) | (programPart << (TEXTURE_BITS + DEPTH_BITS))
+		| (texturePart << DEPTH_BITS) | depthBits;
+	command.program_ = program_;
+	command.mesh_ = mesh;
+	command.texture_ = texture;
+	command.index_ = index;
+	commands_.push_back(command);
+}
+
+void Junior::RenderQueue::Sort()
+{
+	size_t count = commands_.size();
+	if (count < 2)
+	{
+		return;
+	}
+	sortBuffer_.resize(count);
+
+	// Sort one byte at a time from the least significant one, every pass keeps the order of the last one for equal bytes
+	for (unsigned shift = 0; shift < 64; shift += 8)
+	{
+		size_t offsets[256] = { 0 };
+		for (const RenderCommand& command : commands_)
+		{
+			++offsets[(command.key_ >> shift) & 0xFF];
+		}
+		// Most of the key is shared by every command, layers and programs especially, so those passes are skipped
+		if (offsets[(commands_[0].key_ >> shift) & 0xFF] == count)
+		{
+			continue;
+		}
+
+		// Turn the counts into where every byte value starts
+		size_t start = 0;
+		for (size_t& offset : offsets)
+		{
+			size_t bucketSize = offset;
+			offset = start;
+			start += bucketSize;
+		}
+		for (const RenderCommand& command : commands_)
+		{
+			sortBuffer_[offsets[(command.key_ >> shift) & 0xFF]++] = command;
+		}
+		commands_.swap(sortBuffer_);
+	}
+}
+
+void Junior::RenderQueue::Execute(const Mat3& cameraMatrix, Texture* textureBank)
+{
+	programChanges_ = 0;
+	meshChanges_ = 0;
+	textureChanges_ = 0;
+	drawCount_ = 0;
+
+	DrawProgram* program = nullptr;
+	Mesh* mesh = nullptr;
+	unsigned texture = 0;
+	for (const RenderCommand& command : commands_)
+	{
+		if (command.program_ != program)
+		{
+			if (mesh)
+			{
+				mesh->EndBinding();
+				mesh = nullptr;
+			}
+			program = command.program_;
+			program->Bind();
+			++programChanges_;
+
+			// Every program draws with the same camera and texture array
+			GLuint cameraLocation = glGetUniformLocation(program->programID_, "camera");
+			glUniformMatrix4fv(cameraLocation, 1, GL_FALSE, cameraMatrix.m_);
+			GLuint textureLocation = glGetUniformLocation(program->programID_, "diffuse");
+			glActiveTexture(GL_TEXTURE0);
+			textureBank->BindTexture();
+			glUniform1i(textureLocation, 0);
+		}
+		if (command.mesh_ != mesh)
+		{
+			if (mesh)
+			{
+				mesh->EndBinding();
+			}
+			mesh = command.mesh_;
+			mesh->StartBinding();
+			++meshChanges_;
+
+			// The texture is set through the mesh, so a new mesh always binds it
+			texture = command.texture_;
+			mesh->BindTexture(command, program->programID_);
+			++textureChanges_;
+		}
+		else if (command.texture_ != texture)
+		{
+			texture = command.texture_;
+			mesh->BindTexture(command, program->programID_);
+			++textureChanges_;
+		}
+
+		mesh->DrawCommand(command, program->programID_);
+		++drawCount_;
+	}
+
+	if (mesh)
+	{
+		mesh->EndBinding();
+	}
+	if (program)
+	{
+		textureBank->UnbindTexture();
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		program->UnBind();
+	}
+}
+
+const std::vector<Junior::RenderCommand>& Junior::RenderQueue::GetCommands() const
+{
+	return commands_;
+}
+
+unsigned Junior::RenderQueue::GetProgramChangeCount() const
+{
+	return programChanges_;
+}
+
+unsigned Junior::RenderQueue::GetMeshChangeCount() const
+{
+	return meshChanges_;
+}
+
+unsigned Junior::RenderQueue::GetTextureChangeCount() const
+{
+	return textureChanges_;
+}
+
+unsigned Junior::RenderQueue::GetDrawCount() const
+{
+	return drawCount_;
+}
\ No newline at end of file
@@ -4,7 +4,7 @@
  * File Name: Sprite.cpp
  * Description: Defines how Sprite works
  * Created: 13 Feb 2019
- * Last Modified: 10 Sep 2019
+ * Last Modified: 17 Oct 2026
 */
 
 // Includes
@@ -19,72 +19,94 @@
 #include <iostream>				// IO STREAM
 #include "ResourceManager.h"	// Resource Manager
 
+// Private Structures
+
+Junior::Sprite::Data::Data()
+	: path_(), texture_(nullptr), atlasNode_(nullptr), atlas_(nullptr)
+{
+}
+
+Junior::Sprite::Data::Data(const Data& other)
+	: path_(other.path_), texture_(nullptr), atlasNode_(other.atlasNode_), atlas_(other.atlas_)
+{
+	if (path_ != "")
+	{
+		texture_ = ResourceManager::GetInstance().GetResource<Texture>(path_);
+	}
+}
+
+Junior::Sprite::Data::~Data()
+{
+	delete texture_;
+}
+
 // Public Member Functions
 Junior::Sprite::Sprite()
-	: Component(), path_(), texture_(nullptr), atlasNode_(nullptr), atlas_(nullptr)
+	: Component(), isOnAtlas_(false), data_()
 {
 }
 
 Junior::Sprite::Sprite(const std::string& path)
-	: Component(), path_(path), texture_(nullptr), atlasNode_(nullptr), atlas_(nullptr)
+	: Component(), isOnAtlas_(false), data_()
 {
-	texture_ = ResourceManager::GetInstance().GetResource<Texture>("path");
+	Data& data = data_.Write();
+	data.path_ = path;
+	data.texture_ = ResourceManager::GetInstance().GetResource<Texture>("path");
 }
 
 void Junior::Sprite::Initialize()
 {
 	// Debug printing
 	Debug& debug = Debug::GetInstance();
-	if (texture_)
+	if (data_.Read().texture_)
 	{
-		// Get the texture inside the texture atlas
-		Graphics& graphics = Graphics::GetInstance();
-		atlas_ = graphics.GetTextureAtlas();
-		// Create the node to store inside the tree
-		const std::string& textureDir = texture_->GetResourceDir();
-		atlasNode_ = atlas_->Find(textureDir);
-		// If we found the node, then we skip creating the node
-		if (!atlasNode_)
+		// Copies of a sprite that was already initialized find the node in the shared data
+		if (!data_.Read().atlasNode_)
 		{
-			// Otherwise, we need to create it
-			atlasNode_ = new AtlasNode(texture_->GetDimension(0), texture_->GetDimension(1), textureDir);
-			atlas_->Push(&atlasNode_);
-			atlas_->UpdateNodePixels(atlasNode_, texture_->GetPixels());
-			graphics.UpdateTextureAtlas();
+			Data& data = data_.Write();
+			// Get the texture inside the texture atlas
+			Graphics& graphics = Graphics::GetInstance();
+			data.atlas_ = graphics.GetTextureAtlas();
+			// Create the node to store inside the tree
+			const std::string& textureDir = data.texture_->GetResourceDir();
+			data.atlasNode_ = data.atlas_->Find(textureDir);
+			// If we found the node, then we skip creating the node
+			if (!data.atlasNode_)
+			{
+				// Otherwise, we need to create it
+				data.atlasNode_ = new AtlasNode(data.texture_->GetDimension(0), data.texture_->GetDimension(1), textureDir);
+				data.atlas_->Push(&data.atlasNode_);
+				data.atlas_->UpdateNodePixels(data.atlasNode_, data.texture_->GetPixels());
+				graphics.UpdateTextureAtlas();
+			}
 		}
 		// X offset, Y offset and uniform scale
-		atlasScale_.x_ = static_cast<float>(atlasNode_->width_) / static_cast<float>(atlas_->GetWidth());
-		atlasScale_.y_ = static_cast<float>(atlasNode_->height_) / static_cast<float>(atlas_->GetHeight());
-		atlasOffset_.x_ = static_cast<float>(atlasNode_->xPos_) / static_cast<float>(atlas_->GetWidth());
-		atlasOffset_.y_ = static_cast<float>(atlasNode_->yPos_) / static_cast<float>(atlas_->GetHeight());
+		const Data& data = data_.Read();
+		atlasScale_.x_ = static_cast<float>(data.atlasNode_->width_) / static_cast<float>(data.atlas_->GetWidth());
+		atlasScale_.y_ = static_cast<float>(data.atlasNode_->height_) / static_cast<float>(data.atlas_->GetHeight());
+		atlasOffset_.x_ = static_cast<float>(data.atlasNode_->xPos_) / static_cast<float>(data.atlas_->GetWidth());
+		atlasOffset_.y_ = static_cast<float>(data.atlasNode_->yPos_) / static_cast<float>(data.atlas_->GetHeight());
 	}
 }
 
 Junior::Sprite::Sprite(const Sprite& sprite)
-	: path_(sprite.path_), atlasNode_(nullptr), atlas_(nullptr), isOnAtlas_(false)
-{
-	if (path_ != "")
-	{
-		texture_ = ResourceManager::GetInstance().GetResource<Texture>(path_);
-	}
-}
-
-void Junior::Sprite::Update(double dt)
+	: Component(), isOnAtlas_(false), atlasOffset_(sprite.atlasOffset_), atlasScale_(sprite.atlasScale_), data_(sprite.data_)
 {
 }
 
 void Junior::Sprite::Unload()
 {
-	delete texture_;
+	// The texture is released with the shared data, once the last sprite using it is gone
 }
 
 void Junior::Sprite::SetUVModifications(float xOffset, float yOffset)
 {
+	const Data& data = data_.Read();
 	SetUVModifications(
 		xOffset, 
 		yOffset, 
-		static_cast<float>(texture_->GetDimension(0)) / static_cast<float>(atlas_->GetWidth()),
-		static_cast<float>(texture_->GetDimension(1)) / static_cast<float>(atlas_->GetHeight())
+		static_cast<float>(data.texture_->GetDimension(0)) / static_cast<float>(data.atlas_->GetWidth()),
+		static_cast<float>(data.texture_->GetDimension(1)) / static_cast<float>(data.atlas_->GetHeight())
 	);
 }
 
@@ -97,25 +119,26 @@ void Junior::Sprite::SetUVModifications(float xOffset, float yOffset, float xSca
 void Junior::Sprite::LoadFromDisk(const std::string& path)
 {
 	// We can only add a spot to the texture altas once, no more
-	if (atlasNode_)
+	if (data_.Read().atlasNode_)
 		return;
 
-	texture_->LoadFromDisk(path);
+	Data& data = data_.Write();
+	data.texture_->LoadFromDisk(path);
 	Graphics& graphics = Graphics::GetInstance();
 	TextureAtlas* atlas = graphics.GetTextureAtlas();
 	// Create the node to store inside the tree
-	atlasNode_ = new AtlasNode(texture_->GetDimension(0), texture_->GetDimension(1));
-	atlas->Push(&atlasNode_);
+	data.atlasNode_ = new AtlasNode(data.texture_->GetDimension(0), data.texture_->GetDimension(1));
+	atlas->Push(&data.atlasNode_);
 }
 
 Junior::Texture* Junior::Sprite::GetTexture() const
 {
-	return texture_;
+	return data_.Read().texture_;
 }
 
 Junior::AtlasNode* Junior::Sprite::GetNode() const
 {
-	return atlasNode_;
+	return data_.Read().atlasNode_;
 }
 
 const Junior::Vec3& Junior::Sprite::GetAtlasOffset() const
@@ -130,19 +153,29 @@ const Junior::Vec3& Junior::Sprite::GetAtlasScale() const
 
 unsigned Junior::Sprite::GetAtlasID() const
 {
-	return atlas_->GetID();
+	return data_.Read().atlas_->GetID();
 }
 
 void Junior::Sprite::Serialize(Parser& parser) const
 {
 	// Only serialize the path to the texture
-	parser.WriteVariable("texturePath", path_);
+	parser.WriteVariable("texturePath", data_.Read().path_);
 }
 
 void Junior::Sprite::Deserialize(Parser& parser)
 {
 	// Deserialize the path to the texture and load the sprite's texture
-	delete texture_;
-	parser.ReadVariable("texturePath", path_);
-	texture_ = ResourceManager::GetInstance().GetResource<Texture>(path_);
+	Data& data = data_.Write();
+	delete data.texture_;
+	data.atlasNode_ = nullptr;
+	data.atlas_ = nullptr;
+	parser.ReadVariable("texturePath", data.path_);
+	data.texture_ = ResourceManager::GetInstance().GetResource<Texture>(data.path_);
+}
+
+// Public Static Functions
+
+void Junior::Sprite::DeclareAccess(ComponentAccess&)
+{
+	// Sprites do not touch any other component while updating
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 * Author: David Wong
 * Email: david.wongcascante@digipen.edu
 * Date Created: 1 May 2018
-* Last Modified: 26 Apr 2019
+* Last Modified: 17 Oct 2026
 * File name: Transform.cpp
 * Description: The Transform data type really just holds data about the Transform, we are going
 *	to define the constructor to 
@@ -18,18 +18,37 @@
 #include "LinearMath.h"			// Linear Math, Helper Functions
 #include "Camera.h"				// Camera
 #include "Parser.h"				// Parse
+#include "TransformHierarchy.h"	// Transform Hierarchy
+
+// Private Static Variables
+
+std::atomic<unsigned> Junior::Transform::recomputedThisFrame_(0);
+unsigned Junior::Transform::recomputedLastFrame_ = 0;
+unsigned Junior::Transform::fixedStep_ = 0;
+bool Junior::Transform::inFixedStep_ = false;
 
 // Public Member Functions
 
 Junior::Transform::Transform()
-	: Component(), localRot_(0.0f), localTranslation_({ 0, 0, 0, 1 }), localScaling_({ 1, 1, 1, 0 }), isDirty_(true)
+	: Component(), localTransformation_(AffineIdentity()), globalTransformation_(AffineIdentity()), globalDepth_(0.0f), globalDepthScale_(1.0f),
+	previousTransformation_(AffineIdentity()), previousDepth_(0.0f), previousStep_(0), hasPrevious_(false), localTranslation_({ 0, 0, 0, 1 }),
+	localScaling_({ 1, 1, 1, 0 }), localRot_(0.0f), isDirty_(true), isGlobalDirty_(true), camera_(nullptr), hierarchyLevel_(-1), hierarchyIndex_(0)
 {
 }
 
 Junior::Transform::Transform(const Transform& other)
-	: Component(), localRot_(other.localRot_), localTranslation_(other.localTranslation_), localScaling_(other.localScaling_),
-	localTransformation_(other.localTransformation_), isDirty_(true)
+	: Component(), localTransformation_(other.localTransformation_), globalTransformation_(AffineIdentity()), globalDepth_(0.0f), globalDepthScale_(1.0f),
+	previousTransformation_(AffineIdentity()), previousDepth_(0.0f), previousStep_(0), hasPrevious_(false), localTranslation_(other.localTranslation_),
+	localScaling_(other.localScaling_), localRot_(other.localRot_), isDirty_(true), isGlobalDirty_(true), camera_(nullptr), hierarchyLevel_(-1), hierarchyIndex_(0)
+{
+}
+
+Junior::Transform::~Transform()
 {
+	if (hierarchyLevel_ >= 0)
+	{
+		TransformHierarchy::GetInstance().Remove(this);
+	}
 }
 
 void Junior::Transform::Initialize()
@@ -39,17 +58,61 @@ void Junior::Transform::Initialize()
 	// Find the owner's camera
 	camera_ = owner_->GetComponent<Camera>();
 	ReconstructTransformation();
+	// Force the world transformation to be rebuilt so the camera receives it
+	isGlobalDirty_ = false;
+	MarkGlobalDirty();
+	// There is nothing to interpolate from yet
+	hasPrevious_ = false;
+	// Archetypes are never updated, so only the transforms of live objects go into the hierarchy
+	if (hierarchyLevel_ < 0 && !owner_->IsArchetype())
+	{
+		TransformHierarchy::GetInstance().Add(this);
+	}
 }
 
-void Junior::Transform::Update(double ms)
+void Junior::Transform::Unload()
 {
-	// Reconstruct the matrix if necessary
-	ReconstructTransformation();
-	Mat3 transformation = GetGlobalTransformation();
+	if (hierarchyLevel_ >= 0)
+	{
+		TransformHierarchy::GetInstance().Remove(this);
+	}
 }
 
-void Junior::Transform::Unload()
+void Junior::Transform::MarkGlobalDirty()
+{
+	// Keep the world transformation from before the fixed update the first time it changes the transform
+	if (inFixedStep_ && previousStep_ != fixedStep_)
+	{
+		previousTransformation_ = globalTransformation_;
+		previousDepth_ = globalDepth_;
+		previousStep_ = fixedStep_;
+		hasPrevious_ = !isGlobalDirty_;
+	}
+
+	if (isGlobalDirty_)
+		return;
+
+	isGlobalDirty_ = true;
+	if (owner_)
+	{
+		for (GameObject* child : owner_->GetChildren())
+		{
+			Transform* childTransform = child->GetComponent<Transform>();
+			if (childTransform)
+			{
+				childTransform->MarkGlobalDirty();
+			}
+		}
+	}
+}
+
+void Junior::Transform::OnParentChanged()
 {
+	MarkGlobalDirty();
+	if (hierarchyLevel_ >= 0)
+	{
+		TransformHierarchy::GetInstance().Reparent(this);
+	}
 }
 
 void Junior::Transform::SetLocalTranslation(const Vec3& other)
@@ -59,6 +122,7 @@ void Junior::Transform::SetLocalTranslation(const Vec3& other)
 
 	isDirty_ = true;
 	localTranslation_ = other;
+	MarkGlobalDirty();
 }
 
 void Junior::Transform::SetLocalScaling(const Vec3& other)
@@ -68,6 +132,7 @@ void Junior::Transform::SetLocalScaling(const Vec3& other)
 
 	isDirty_ = true;
 	localScaling_ = other;
+	MarkGlobalDirty();
 }
 
 void Junior::Transform::SetLocalRotation(const float other)
@@ -77,6 +142,7 @@ void Junior::Transform::SetLocalRotation(const float other)
 
 	isDirty_ = true;
 	localRot_ = other;
+	MarkGlobalDirty();
 }
 
 const Junior::Vec3& Junior::Transform::GetLocalTranslation() const
@@ -100,58 +166,91 @@ const float Junior::Transform::GetLocalRotation() const
 
 Junior::Vec3 Junior::Transform::GetGlobalTranslation() const
 {
-	Mat3 globalTransform = GetGlobalTransformation();
-	return Vec3(globalTransform.m03_, globalTransform.m13_, globalTransform.m23_);
+	const Affine2D& globalTransform = GetGlobalAffine();
+	return Vec3(globalTransform.m02_, globalTransform.m12_, globalDepth_);
 }
 
 float Junior::Transform::GetGlobalRotation() const
 {
-	Mat3 globalTransform = GetGlobalTransformation();
-	float xScale = Length(Vec3(globalTransform.m00_, globalTransform.m11_, globalTransform.m22_, 0));
-	float cosAngle = globalTransform.m00_ / xScale;
-	// Return the angle corresponding to the cosine of it
-	return acosf(cosAngle);
+	// The first column is the x axis after being rotated and scaled
+	// Unlike the arc cosine this used before, the angle keeps its sign, between -pi and pi, and ignores the scale
+	const Affine2D& globalTransform = GetGlobalAffine();
+	return atan2f(globalTransform.m10_, globalTransform.m00_);
 }
 
 Junior::Vec3 Junior::Transform::GetGlobalScaling() const
 {
-	Mat3 globalTransform = GetGlobalTransformation();
-	float xScale = Length(Vec3(globalTransform.m00_, globalTransform.m01_, globalTransform.m02_, 0));
-	float yScale = Length(Vec3(globalTransform.m10_, globalTransform.m11_, globalTransform.m12_, 0));
-	float zScale = Length(Vec3(globalTransform.m20_, globalTransform.m21_, globalTransform.m22_, 0));
+	const Affine2D& globalTransform = GetGlobalAffine();
+	float xScale = sqrtf(globalTransform.m00_ * globalTransform.m00_ + globalTransform.m10_ * globalTransform.m10_);
+	float yScale = sqrtf(globalTransform.m01_ * globalTransform.m01_ + globalTransform.m11_ * globalTransform.m11_);
+
+	return Vec3(xScale, yScale, fabsf(globalDepthScale_), 0);
+}
 
-	return Vec3(xScale, yScale, zScale, 0);
+Junior::Mat3 Junior::Transform::GetLocalTransformation() const
+{
+	ReconstructTransformation();
+	return ToMat3(localTransformation_, localScaling_.z_, localTranslation_.z_);
 }
 
-const Junior::Mat3& Junior::Transform::GetLocalTransformation() const
+Junior::Mat3 Junior::Transform::GetGlobalTransformation() const
 {
-	return localTransformation_;
+	const Affine2D& globalTransform = GetGlobalAffine();
+	return ToMat3(globalTransform, globalDepthScale_, globalDepth_);
 }
 
-const Junior::Mat3 Junior::Transform::GetGlobalTransformation() const
+const Junior::Affine2D& Junior::Transform::GetGlobalAffine() const
 {
-	Mat3 globalTransformation = Identity();
+	if (!isGlobalDirty_)
+	{
+		return globalTransformation_;
+	}
+
+	// If the transform component exists on the parent, then multiply this transformation by the parent's transform
+	// The parent is rebuilt first if it is dirty as well
+	const Transform* parentTransform = nullptr;
 	if (owner_)
 	{
 		// Get the parent of the object
 		GameObject* parent = owner_->GetParent();
-		// If the transform component exists on the parent, then multiply this transformation by the parent's transform
 		if (parent)
 		{
-			Transform* parentTransform = parent->GetComponent<Transform>();
+			parentTransform = parent->GetComponent<Transform>();
 			if (parentTransform)
 			{
-				globalTransformation = parentTransform->GetGlobalTransformation();
+				parentTransform->GetGlobalAffine();
 			}
 		}
 	}
-	// Total Transformation
-	Mat3 totalTransformation = globalTransformation * localTransformation_;
-	// Set the camera's view matrix
-	if (camera_)
-		camera_->UpdateViewMatrix(totalTransformation);
+	RebuildGlobalTransformation(parentTransform);
 
-	return totalTransformation;
+	return globalTransformation_;
+}
+
+float Junior::Transform::GetGlobalDepth() const
+{
+	GetGlobalAffine();
+	return globalDepth_;
+}
+
+Junior::Affine2D Junior::Transform::GetInterpolatedAffine(float alpha) const
+{
+	const Affine2D& current = GetGlobalAffine();
+	if (!hasPrevious_ || previousStep_ != fixedStep_)
+	{
+		return current;
+	}
+	return AffineLerp(previousTransformation_, current, alpha);
+}
+
+float Junior::Transform::GetInterpolatedDepth(float alpha) const
+{
+	float current = GetGlobalDepth();
+	if (!hasPrevious_ || previousStep_ != fixedStep_)
+	{
+		return current;
+	}
+	return previousDepth_ + (current - previousDepth_) * alpha;
 }
 
 void Junior::Transform::Serialize(Parser& parser) const
@@ -172,14 +271,68 @@ void Junior::Transform::Deserialize(Parser& parser)
 	// Reconstruct the transformation
 	isDirty_ = true;
 	ReconstructTransformation();
+	MarkGlobalDirty();
+}
+
+// Public Static Functions
+
+void Junior::Transform::BeginFrame()
+{
+	recomputedLastFrame_ = recomputedThisFrame_;
+	recomputedThisFrame_ = 0;
+}
+
+unsigned Junior::Transform::GetRecomputedCount()
+{
+	return recomputedLastFrame_;
+}
+
+void Junior::Transform::BeginFixedStep()
+{
+	++fixedStep_;
+	inFixedStep_ = true;
+}
+
+void Junior::Transform::EndFixedStep()
+{
+	inFixedStep_ = false;
+}
+
+void Junior::Transform::DeclareAccess(ComponentAccess& access)
+{
+	// Rebuilding the world transformation updates the view matrix of the object's camera
+	access.Writes<Camera>();
 }
 
 // Private Member Functions //
-void Junior::Transform::ReconstructTransformation()
+void Junior::Transform::RebuildGlobalTransformation(const Transform* parent) const
+{
+	ReconstructTransformation();
+	// Rotations only happen around the z axis, so the z axis is carried on its own next to the xy plane
+	if (parent)
+	{
+		globalTransformation_ = parent->globalTransformation_ * localTransformation_;
+		globalDepth_ = parent->globalDepthScale_ * localTranslation_.z_ + parent->globalDepth_;
+		globalDepthScale_ = parent->globalDepthScale_ * localScaling_.z_;
+	}
+	else
+	{
+		globalTransformation_ = localTransformation_;
+		globalDepth_ = localTranslation_.z_;
+		globalDepthScale_ = localScaling_.z_;
+	}
+	isGlobalDirty_ = false;
+	++recomputedThisFrame_;
+	// Set the camera's view matrix
+	if (camera_)
+		camera_->UpdateViewMatrix(ToMat3(globalTransformation_, globalDepthScale_, globalDepth_));
+}
+
+void Junior::Transform::ReconstructTransformation() const
 {
 	if (isDirty_)
 	{
-		localTransformation_ = Translation(localTranslation_) * Rotation(localRot_) * Scale(localScaling_);
+		localTransformation_ = AffineCompose(localTranslation_, localRot_, localScaling_);
 		isDirty_ = false;
 	}
 }
\ No newline at end of file
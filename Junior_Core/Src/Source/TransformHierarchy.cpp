@@ -0,0 +1,292 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: TransformHierarchy.cpp
+* Description: Keeps every transform in flat arrays sorted by depth, so world transformations can be rebuilt level by level
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "TransformHierarchy.h"		// Transform Hierarchy
+#include "Transform.h"				// Transform
+#include "GameObject.h"				// Game Object
+#include "LinearMath.h"				// Compose Transformations
+#include "Affine2D.h"				// Affine 2D
+#include "JobSystem.h"				// Job System
+
+// Private Member Functions
+
+Junior::TransformHierarchy::TransformHierarchy()
+	: levels_(), parallelThreshold_(4096), batchThreshold_(16)
+{
+}
+
+Junior::Transform* Junior::TransformHierarchy::FindParentTransform(const Transform* transform)
+{
+	GameObject* owner = transform->owner_;
+	if (!owner || !owner->GetParent())
+	{
+		return nullptr;
+	}
+	return owner->GetParent()->GetComponent<Transform>();
+}
+
+void Junior::TransformHierarchy::Insert(Transform* transform)
+{
+	// The transform goes one level below its parent, or at the top when there is no parent in the hierarchy
+	Transform* parent = FindParentTransform(transform);
+	Entry entry = { transform, noParent_ };
+	size_t level = 0;
+	if (parent)
+	{
+		if (parent->hierarchyLevel_ >= 0)
+		{
+			level = parent->hierarchyLevel_ + 1;
+			entry.parent_ = static_cast<int>(parent->hierarchyIndex_);
+		}
+		else
+		{
+			entry.parent_ = unlinkedParent_;
+		}
+	}
+
+	if (levels_.size() <= level)
+	{
+		levels_.resize(level + 1);
+	}
+	transform->hierarchyLevel_ = static_cast<int>(level);
+	transform->hierarchyIndex_ = levels_[level].size();
+	levels_[level].push_back(entry);
+}
+
+void Junior::TransformHierarchy::Erase(Transform* transform)
+{
+	size_t level = transform->hierarchyLevel_;
+	size_t index = transform->hierarchyIndex_;
+	std::vector<Entry>& entries = levels_[level];
+
+	// The children lose their parent's entry
+	if (transform->owner_)
+	{
+		for (GameObject* child : transform->owner_->GetChildren())
+		{
+			Transform* childTransform = child->GetComponent<Transform>();
+			if (childTransform && childTransform->hierarchyLevel_ == static_cast<int>(level + 1))
+			{
+				levels_[level + 1][childTransform->hierarchyIndex_].parent_ = unlinkedParent_;
+			}
+		}
+	}
+
+	// Move the last entry into the empty spot, and point its children at its new index
+	Entry last = entries.back();
+	entries.pop_back();
+	if (index < entries.size())
+	{
+		entries[index] = last;
+		last.transform_->hierarchyIndex_ = index;
+		if (last.transform_->owner_ && level + 1 < levels_.size())
+		{
+			for (GameObject* child : last.transform_->owner_->GetChildren())
+			{
+				Transform* childTransform = child->GetComponent<Transform>();
+				if (childTransform && childTransform->hierarchyLevel_ == static_cast<int>(level + 1))
+				{
+					levels_[level + 1][childTransform->hierarchyIndex_].parent_ = static_cast<int>(index);
+				}
+			}
+		}
+	}
+
+	// Drop empty levels at the bottom of the hierarchy
+	while (!levels_.empty() && levels_.back().empty())
+	{
+		levels_.pop_back();
+	}
+
+	transform->hierarchyLevel_ = -1;
+	transform->hierarchyIndex_ = 0;
+}
+
+void Junior::TransformHierarchy::ComposeRange(size_t level, size_t begin, size_t end)
+{
+	// Gather the changed transforms in blocks, so the batch works out of small arrays on the stack
+	const size_t blockSize = 64;
+	Transform* targets[blockSize];
+	Vec3 translations[blockSize];
+	float rotations[blockSize];
+	Vec3 scalings[blockSize];
+	Affine2D locals[blockSize];
+	size_t count = 0;
+
+	const std::vector<Entry>& entries = levels_[level];
+	for (size_t i = begin; i <= end; ++i)
+	{
+		// Build the block when it is full, or when we reach the end with enough of them to be worth it
+		if (count == blockSize || (i == end && count >= batchThreshold_))
+		{
+			ComposeTransformations(translations, rotations, scalings, locals, count);
+			for (size_t j = 0; j < count; ++j)
+			{
+				targets[j]->localTransformation_ = locals[j];
+				targets[j]->isDirty_ = false;
+			}
+			count = 0;
+		}
+		if (i == end)
+		{
+			break;
+		}
+
+		Transform* transform = entries[i].transform_;
+		if (transform->isDirty_)
+		{
+			targets[count] = transform;
+			translations[count] = transform->localTranslation_;
+			rotations[count] = transform->localRot_;
+			scalings[count] = transform->localScaling_;
+			++count;
+		}
+	}
+}
+
+void Junior::TransformHierarchy::RebuildRange(size_t level, size_t begin, size_t end)
+{
+	// Build the changed local transformations together first, the ones left are built one by one below
+	ComposeRange(level, begin, end);
+
+	const std::vector<Entry>& entries = levels_[level];
+	for (size_t i = begin; i < end; ++i)
+	{
+		const Entry& entry = entries[i];
+		if (!entry.transform_->isGlobalDirty_ || entry.parent_ == unlinkedParent_)
+		{
+			continue;
+		}
+
+		if (entry.parent_ == noParent_)
+		{
+			entry.transform_->RebuildGlobalTransformation(nullptr);
+		}
+		else
+		{
+			// A parent that could not be rebuilt leaves its children dirty as well
+			const Transform* parent = levels_[level - 1][entry.parent_].transform_;
+			if (!parent->isGlobalDirty_)
+			{
+				entry.transform_->RebuildGlobalTransformation(parent);
+			}
+		}
+	}
+}
+
+// Public Member Functions
+
+void Junior::TransformHierarchy::Add(Transform* transform)
+{
+	if (transform->hierarchyLevel_ >= 0)
+	{
+		return;
+	}
+	Insert(transform);
+
+	// Any children that were added before this transform can now be linked to it
+	if (transform->owner_)
+	{
+		for (GameObject* child : transform->owner_->GetChildren())
+		{
+			Transform* childTransform = child->GetComponent<Transform>();
+			if (childTransform && childTransform->hierarchyLevel_ >= 0)
+			{
+				Reparent(childTransform);
+			}
+		}
+	}
+}
+
+void Junior::TransformHierarchy::Remove(Transform* transform)
+{
+	if (transform->hierarchyLevel_ < 0)
+	{
+		return;
+	}
+	Erase(transform);
+}
+
+void Junior::TransformHierarchy::Reparent(Transform* transform)
+{
+	if (transform->hierarchyLevel_ < 0)
+	{
+		return;
+	}
+
+	// Nothing to do when the transform already sits right below its parent
+	Transform* parent = FindParentTransform(transform);
+	const Entry& current = levels_[transform->hierarchyLevel_][transform->hierarchyIndex_];
+	if (parent && parent->hierarchyLevel_ >= 0)
+	{
+		if (transform->hierarchyLevel_ == parent->hierarchyLevel_ + 1 && current.parent_ == static_cast<int>(parent->hierarchyIndex_))
+		{
+			return;
+		}
+	}
+	else if (transform->hierarchyLevel_ == 0 && current.parent_ == (parent ? unlinkedParent_ : noParent_))
+	{
+		return;
+	}
+
+	Erase(transform);
+	Insert(transform);
+
+	// Then move everything below it, one level at a time through the recursion
+	if (transform->owner_)
+	{
+		for (GameObject* child : transform->owner_->GetChildren())
+		{
+			Transform* childTransform = child->GetComponent<Transform>();
+			if (childTransform && childTransform->hierarchyLevel_ >= 0)
+			{
+				Reparent(childTransform);
+			}
+		}
+	}
+}
+
+void Junior::TransformHierarchy::Update()
+{
+	JobSystem& jobSystem = JobSystem::GetInstance();
+	for (size_t level = 0; level < levels_.size(); ++level)
+	{
+		size_t count = levels_[level].size();
+		if (count < parallelThreshold_ || jobSystem.GetThreadCount() == 1)
+		{
+			RebuildRange(level, 0, count);
+			continue;
+		}
+
+		// Every entry in a level only reads from the level above, so the level can be split freely
+		jobSystem.ParallelFor(0, count, 0, [this, level](size_t begin, size_t end) { RebuildRange(level, begin, end); });
+	}
+}
+
+void Junior::TransformHierarchy::SetParallelThreshold(size_t threshold)
+{
+	parallelThreshold_ = threshold;
+}
+
+void Junior::TransformHierarchy::SetBatchThreshold(size_t threshold)
+{
+	batchThreshold_ = threshold;
+}
+
+size_t Junior::TransformHierarchy::GetLevelCount() const
+{
+	return levels_.size();
+}
+
+Junior::TransformHierarchy& Junior::TransformHierarchy::GetInstance()
+{
+	static TransformHierarchy singleton_;
+	return singleton_;
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+/*
+* Author: David Wong
+* Email: david.wongcascante@digipen.edu
+* File name: UpdatePhases.cpp
+* Description: Groups the components of every object by type, and updates the types that do not touch each other's data at the same time
+* Created: 17 Oct 2026
+* Last Modified: 17 Oct 2026
+*/
+
+// Includes
+#include "UpdatePhases.h"			// Update Phases
+#include "GameObject.h"				// Game Object
+#include "JobSystem.h"				// Job System
+#include <algorithm>				// Find
+
+// Private Member Functions
+
+Junior::UpdatePhases::Batch& Junior::UpdatePhases::GetBatch(ComponentTypeID type, const ComponentAccess* access)
+{
+	if (batches_.size() <= type)
+	{
+		batches_.resize(type + 1);
+	}
+	Batch& batch = batches_[type];
+	batch.access_ = access;
+	return batch;
+}
+
+void Junior::UpdatePhases::Order(const std::vector<ComponentTypeID>& types)
+{
+	for (size_t i = 0; i < types.size(); ++i)
+	{
+		Batch& batch = batches_[types[i]];
+		if (batch.ordered_)
+		{
+			continue;
+		}
+
+		// Find the next type of the sequence that is in the order already
+		std::vector<ComponentTypeID>::iterator position = order_.end();
+		for (size_t next = i + 1; next < types.size(); ++next)
+		{
+			if (batches_[types[next]].ordered_)
+			{
+				position = std::find(order_.begin(), order_.end(), types[next]);
+				break;
+			}
+		}
+		order_.insert(position, types[i]);
+		batch.ordered_ = true;
+	}
+}
+
+void Junior::UpdatePhases::RunBatch(ComponentTypeID type, double dt, bool fixed)
+{
+	Batch& batch = batches_[type];
+	for (ComponentContainer* component : batch.components_)
+	{
+		if (component->IsUpdateable())
+		{
+			if (fixed)
+			{
+				component->FixedUpdate(dt);
+			}
+			else
+			{
+				component->Update(dt);
+			}
+		}
+	}
+	for (const std::pair<ArchetypeStorage*, size_t>& column : batch.columns_)
+	{
+		if (fixed)
+		{
+			column.first->FixedUpdateColumn(column.second, 0, column.first->GetChunkCount(), dt);
+		}
+		else
+		{
+			column.first->UpdateColumn(column.second, 0, column.first->GetChunkCount(), dt);
+		}
+	}
+}
+
+void Junior::UpdatePhases::Run(double dt, bool fixed)
+{
+	JobSystem& jobSystem = JobSystem::GetInstance();
+	for (const std::vector<ComponentTypeID>& wave : waves_)
+	{
+		// The first batch of the wave runs on this thread while the workers take the rest
+		JobCounter counter;
+		for (size_t i = 1; i < wave.size(); ++i)
+		{
+			ComponentTypeID type = wave[i];
+			jobSystem.Run([this, type, dt, fixed]() { RunBatch(type, dt, fixed); }, &counter);
+		}
+		RunBatch(wave[0], dt, fixed);
+		jobSystem.Wait(counter);
+	}
+}
+
+// Public Member Functions
+
+void Junior::UpdatePhases::Build(const std::vector<GameObject*>& objects, const std::map<ArchetypeStorage::Key, ArchetypeStorage*>& storages, bool fixed)
+{
+	// Keep the memory of the batches between frames
+	for (Batch& batch : batches_)
+	{
+		batch.access_ = nullptr;
+		batch.components_.clear();
+		batch.columns_.clear();
+		batch.ordered_ = false;
+	}
+	order_.clear();
+
+	// Serial updates go through the objects first, every object updating its components in order
+	std::vector<ComponentTypeID> types;
+	for (GameObject* object : objects)
+	{
+		if (object->IsDestroyed())
+		{
+			continue;
+		}
+		const std::vector<ComponentContainer*>& components = fixed ? object->GetFixedUpdatingComponents() : object->GetUpdatingComponents();
+		types.clear();
+		for (ComponentContainer* component : components)
+		{
+			GetBatch(component->GetTypeID(), component->GetLayout().access_).components_.push_back(component);
+			types.push_back(component->GetTypeID());
+		}
+		Order(types);
+	}
+	// Then through the storages, every storage updating its columns in the order of its prototype's components
+	for (const auto& storage : storages)
+	{
+		types.clear();
+		for (size_t column = 0; column < storage.second->GetColumnCount(); ++column)
+		{
+			const ComponentLayout& layout = storage.second->GetColumnLayout(column);
+			if (fixed ? layout.fixedUpdateColumn_ != nullptr : layout.updateColumn_ != nullptr)
+			{
+				GetBatch(layout.typeID_, layout.access_).columns_.push_back(std::make_pair(storage.second, column));
+				types.push_back(layout.typeID_);
+			}
+		}
+		Order(types);
+	}
+
+	// Every type goes one wave after the last type before it in the order that it conflicts with
+	// So conflicting types always run in the same order as a serial update would run them
+	waves_.clear();
+	std::vector<size_t> waveOf(order_.size(), 0);
+	for (size_t i = 0; i < order_.size(); ++i)
+	{
+		const Batch& batch = batches_[order_[i]];
+		size_t wave = 0;
+		for (size_t earlier = 0; earlier < i; ++earlier)
+		{
+			if (waveOf[earlier] + 1 > wave && batch.access_->ConflictsWith(*batches_[order_[earlier]].access_))
+			{
+				wave = waveOf[earlier] + 1;
+			}
+		}
+		waveOf[i] = wave;
+		if (waves_.size() <= wave)
+		{
+			waves_.resize(wave + 1);
+		}
+		waves_[wave].push_back(order_[i]);
+	}
+}
+
+void Junior::UpdatePhases::Update(double dt)
+{
+	Run(dt, false);
+}
+
+void Junior::UpdatePhases::FixedUpdate(double dt)
+{
+	Run(dt, true);
+}
+
+size_t Junior::UpdatePhases::GetWaveCount() const
+{
+	return waves_.size();
+}
\ No newline at end of file